@@ -0,0 +1,228 @@
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+benchmark::registry &benchmark::benches()
+{
+    static registry benches;
+    return benches;
+}
+
+bool benchmark::register_bench(std::string name, std::string ns, bench_function function)
+{
+    std::map<std::string, bench_function> &by_ns = benches()[name];
+    if (by_ns.find(ns) != by_ns.end())
+        return false;
+    by_ns[ns] = function;
+    return true;
+}
+
+namespace
+{
+    struct options
+    {
+        std::size_t min_runs;
+        std::size_t max_runs;
+        double min_time;
+        const char *filter;
+        perf_counters *counters;
+    };
+
+    struct summary
+    {
+        double min;
+        double median;
+        double p99;
+        double throughput;
+        std::size_t runs;
+        // Mean count of each hardware event per run (with -p).
+        double events[perf_counters::event_count];
+    };
+
+    double elapsed(const struct timespec &start, const struct timespec &end)
+    {
+        return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+    }
+
+    double percentile(const std::vector<double> &sorted, double p)
+    {
+        std::size_t rank = static_cast<std::size_t>(p * sorted.size() + 0.999999);
+        if (rank == 0)
+            rank = 1;
+        if (rank > sorted.size())
+            rank = sorted.size();
+        return sorted[rank - 1];
+    }
+
+    summary measure(benchmark::bench_function function, const options &opts)
+    {
+        std::vector<double> samples;
+        double total = 0;
+        double items = 0;
+        double events[perf_counters::event_count] = {};
+
+        // One untimed warm-up run to fault pages in and fill the caches.
+        benchmark_state warmup;
+        warmup.reset_timer();
+        function(warmup);
+
+        while (samples.size() < opts.max_runs && (samples.size() < opts.min_runs || total < opts.min_time))
+        {
+            benchmark_state state;
+            struct timespec end;
+
+            state.counters = opts.counters;
+            state.reset_timer();
+            function(state);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            if (opts.counters != NULL)
+            {
+                opts.counters->stop();
+                for (int e = 0; e < perf_counters::event_count; ++e)
+                    events[e] += opts.counters->value(static_cast<perf_counters::event>(e));
+            }
+
+            samples.push_back(elapsed(state.start, end));
+            total += samples.back();
+            items = state.items;
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        summary s;
+        s.min = samples.front();
+        s.median = percentile(samples, 0.5);
+        s.p99 = percentile(samples, 0.99);
+        s.throughput = items > 0 ? items / s.median : 0;
+        s.runs = samples.size();
+        for (int e = 0; e < perf_counters::event_count; ++e)
+            s.events[e] = events[e] / s.runs;
+        return s;
+    }
+
+    void print_summary(const summary *s)
+    {
+        if (s == NULL)
+        {
+            std::cout << std::setw(10) << "-" << std::setw(10) << "-" << std::setw(10) << "-" << std::setw(10) << "-" << " |";
+            return;
+        }
+        std::cout << std::setw(10) << s->min * 1e3
+                  << std::setw(10) << s->median * 1e3
+                  << std::setw(10) << s->p99 * 1e3
+                  << std::setw(10) << s->throughput * 1e-6 << " |";
+    }
+
+    // One line per namespace under the benchmark row, per run.
+    void print_events(const char *ns, const summary *s, const perf_counters &counters)
+    {
+        if (s == NULL)
+            return;
+        std::cout << "    " << std::left << std::setw(4) << ns << std::right;
+        for (int e = 0; e < perf_counters::event_count; ++e)
+        {
+            const perf_counters::event event = static_cast<perf_counters::event>(e);
+            std::cout << " " << perf_counters::name(event) << " ";
+            if (counters.available(event))
+                std::cout << std::setprecision(0) << s->events[e] << std::setprecision(3);
+            else
+                std::cout << "-";
+        }
+        std::cout << std::endl;
+    }
+
+    void usage(const char *name)
+    {
+        std::cerr << "usage: " << name << " [-r min_runs] [-R max_runs] [-t min_seconds] [-p] [filter]" << std::endl;
+    }
+}
+
+int benchmark::run(int argc, char **argv)
+{
+    options opts;
+    opts.min_runs = 10;
+    opts.max_runs = 1000;
+    opts.min_time = 0.5;
+    opts.filter = NULL;
+    opts.counters = NULL;
+    bool with_counters = false;
+
+    for (int index = 1; index < argc; ++index)
+    {
+        if (std::strcmp(argv[index], "-r") == 0 && index + 1 < argc)
+            opts.min_runs = std::strtoul(argv[++index], NULL, 10);
+        else if (std::strcmp(argv[index], "-R") == 0 && index + 1 < argc)
+            opts.max_runs = std::strtoul(argv[++index], NULL, 10);
+        else if (std::strcmp(argv[index], "-t") == 0 && index + 1 < argc)
+            opts.min_time = std::strtod(argv[++index], NULL);
+        else if (std::strcmp(argv[index], "-p") == 0)
+            with_counters = true;
+        else if (argv[index][0] == '-')
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        else
+            opts.filter = argv[index];
+    }
+    if (opts.min_runs == 0)
+        opts.min_runs = 1;
+    if (opts.max_runs < opts.min_runs)
+        opts.max_runs = opts.min_runs;
+
+    perf_counters counters(with_counters);
+    if (with_counters && !counters.available())
+        std::cerr << "perf_event_open: no hardware counters available, reporting wall time only" << std::endl;
+    if (counters.available())
+        opts.counters = &counters;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(32) << "benchmark" << std::right << " |"
+              << std::setw(40) << "std: min  median  p99 (ms)  Mitems/s" << " |"
+              << std::setw(40) << "ft: min  median  p99 (ms)  Mitems/s" << " |"
+              << std::setw(8) << "ft/std" << std::endl;
+
+    for (registry::iterator it = benches().begin(); it != benches().end(); ++it)
+    {
+        if (opts.filter != NULL && it->first.find(opts.filter) == std::string::npos)
+            continue;
+
+        summary results[2];
+        const summary *columns[2] = {NULL, NULL};
+        const char *namespaces[2] = {"std", "ft"};
+
+        for (int column = 0; column < 2; ++column)
+        {
+            std::map<std::string, bench_function>::iterator found = it->second.find(namespaces[column]);
+            if (found == it->second.end())
+                continue;
+            results[column] = measure(found->second, opts);
+            columns[column] = &results[column];
+        }
+
+        std::cout << std::left << std::setw(32) << it->first << std::right << " |";
+        print_summary(columns[0]);
+        print_summary(columns[1]);
+        if (columns[0] != NULL && columns[1] != NULL)
+            std::cout << std::setw(8) << columns[1]->median / columns[0]->median;
+        else
+            std::cout << std::setw(8) << "-";
+        std::cout << std::endl;
+        if (opts.counters != NULL)
+        {
+            print_events("std", columns[0], counters);
+            print_events("ft", columns[1], counters);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    return benchmark::run(argc, argv);
+}
@@ -0,0 +1,74 @@
+#include "benchmark.hpp"
+#include "container/concurrent_stack.hpp"
+#include "container/stack.hpp"
+#include <pthread.h>
+#include <stack>
+
+static const int worker_threads = 4;
+static const int worker_operations = 1 << 17;
+
+// Without a concurrent stack, the std column is what we used to do: a
+// stack behind a mutex. The ft column is ft::concurrent_stack.
+template <class T>
+class locked_stack
+{
+public:
+    locked_stack() { pthread_mutex_init(&_mutex, NULL); }
+
+    ~locked_stack() { pthread_mutex_destroy(&_mutex); }
+
+    void push(const T &value)
+    {
+        pthread_mutex_lock(&_mutex);
+        _stack.push(value);
+        pthread_mutex_unlock(&_mutex);
+    }
+
+    bool try_pop(T &out)
+    {
+        pthread_mutex_lock(&_mutex);
+        const bool found = !_stack.empty();
+        if (found)
+        {
+            out = _stack.top();
+            _stack.pop();
+        }
+        pthread_mutex_unlock(&_mutex);
+        return found;
+    }
+
+private:
+    pthread_mutex_t _mutex;
+    std::stack<T> _stack;
+};
+
+typedef ft::bench::pick<NS_TAG, locked_stack<int>, ft::concurrent_stack<int> >::type stack_type;
+
+static void *churn_worker(void *argument)
+{
+    stack_type *s = static_cast<stack_type *>(argument);
+    long sum = 0;
+    int value;
+    for (int index = 0; index < worker_operations; ++index)
+    {
+        s->push(index);
+        if (s->try_pop(value))
+            sum += value;
+    }
+    benchmark::keep(sum);
+    return NULL;
+}
+
+// push + pop pairs from several threads hammering the same stack.
+BENCH(concurrent_stack, churn)
+{
+    stack_type s;
+    pthread_t threads[worker_threads];
+
+    for (int thread = 0; thread < worker_threads; ++thread)
+        pthread_create(&threads[thread], NULL, churn_worker, &s);
+    for (int thread = 0; thread < worker_threads; ++thread)
+        pthread_join(threads[thread], NULL);
+
+    state.set_items(static_cast<long>(worker_threads) * worker_operations * 2);
+}
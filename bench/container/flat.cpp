@@ -0,0 +1,136 @@
+#include "benchmark.hpp"
+#include "container/flat_set.hpp"
+#include "container/set.hpp"
+#include "container/vector.hpp"
+#include "tree/rb_tree.hpp"
+#include <algorithm>
+#include <set>
+#include <vector>
+
+static const int table_size = 1 << 18;
+
+static unsigned int next_key(unsigned int &seed)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 4;
+}
+
+// std has no flat containers before C++23, so the std column measures the
+// sorted std::vector + std::lower_bound idiom that ft::flat_set packages.
+template <class T>
+class sorted_vector
+{
+public:
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+        _data.insert(_data.end(), first, last);
+        std::sort(_data.begin(), _data.end());
+        _data.erase(std::unique(_data.begin(), _data.end()), _data.end());
+    }
+
+    std::size_t count(const T &k) const { return std::binary_search(_data.begin(), _data.end(), k) ? 1 : 0; }
+
+    std::size_t size() const { return _data.size(); }
+
+private:
+    std::vector<T> _data;
+};
+
+// rb_tree::freeze() has no std counterpart either: it is measured against
+// the same sorted std::vector.
+template <class T>
+class frozen_tree
+{
+public:
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+        ft::rb_tree<T> tree;
+        tree.insert_unique(first, last);
+        _index = tree.freeze();
+    }
+
+    std::size_t count(const T &k) const { return _index.count(k); }
+
+    std::size_t size() const { return _index.size(); }
+
+private:
+    ft::frozen_index<T> _index;
+};
+
+typedef ft::bench::pick<NS_TAG, sorted_vector<unsigned int>, ft::flat_set<unsigned int> >::type table_type;
+
+typedef ft::bench::pick<NS_TAG, sorted_vector<unsigned int>, frozen_tree<unsigned int> >::type frozen_type;
+
+static void random_keys(NS::vector<unsigned int> &keys)
+{
+    unsigned int seed = 42;
+    for (int index = 0; index < table_size; ++index)
+        keys.push_back(next_key(seed));
+}
+
+BENCH(flat_set, build)
+{
+    NS::vector<unsigned int> keys;
+    random_keys(keys);
+
+    state.reset_timer();
+
+    table_type table;
+    table.insert(keys.begin(), keys.end());
+
+    state.set_items(table_size);
+    benchmark::keep(table.size());
+}
+
+BENCH(flat_set, find)
+{
+    NS::vector<unsigned int> keys;
+    random_keys(keys);
+    table_type table;
+    table.insert(keys.begin(), keys.end());
+
+    state.reset_timer();
+
+    unsigned long found = 0;
+    for (int index = 0; index < table_size; ++index)
+        found += table.count(keys[(index * 7919) % table_size]);
+
+    state.set_items(table_size);
+    benchmark::keep(found);
+}
+
+// Same keys and probe order as flat_set_find, through the node-based set.
+BENCH(set, find)
+{
+    NS::vector<unsigned int> keys;
+    random_keys(keys);
+    NS::set<unsigned int> table(keys.begin(), keys.end());
+
+    state.reset_timer();
+
+    unsigned long found = 0;
+    for (int index = 0; index < table_size; ++index)
+        found += table.count(keys[(index * 7919) % table_size]);
+
+    state.set_items(table_size);
+    benchmark::keep(found);
+}
+
+BENCH(frozen_set, find)
+{
+    NS::vector<unsigned int> keys;
+    random_keys(keys);
+    frozen_type table;
+    table.insert(keys.begin(), keys.end());
+
+    state.reset_timer();
+
+    unsigned long found = 0;
+    for (int index = 0; index < table_size; ++index)
+        found += table.count(keys[(index * 7919) % table_size]);
+
+    state.set_items(table_size);
+    benchmark::keep(found);
+}
@@ -0,0 +1,286 @@
+#include "benchmark.hpp"
+#include "container/map.hpp"
+#include "container/set.hpp"
+#include "container/vector.hpp"
+#include "tree/rb_tree.hpp"
+#include <map>
+#include <set>
+#include <vector>
+
+static const int tree_size = 1 << 18;
+
+static unsigned int next_key(unsigned int &seed)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 4;
+}
+
+BENCH(map, insert_random)
+{
+    NS::map<unsigned int, unsigned int> m;
+    unsigned int seed = 42;
+
+    for (int index = 0; index < tree_size; ++index)
+        m.insert(NS::make_pair(next_key(seed), index));
+
+    state.set_items(tree_size);
+    benchmark::keep(m.size());
+}
+
+BENCH(map, insert_sorted_hint)
+{
+    NS::map<int, int> m;
+
+    for (int index = 0; index < tree_size; ++index)
+        m.insert(m.end(), NS::make_pair(index, index));
+
+    state.set_items(tree_size);
+    benchmark::keep(m.size());
+}
+
+BENCH(map, find)
+{
+    NS::map<unsigned int, unsigned int> m;
+    unsigned int seed = 42;
+
+    for (int index = 0; index < tree_size; ++index)
+        m.insert(NS::make_pair(next_key(seed), index));
+
+    state.reset_timer();
+
+    seed = 42;
+    unsigned long found = 0;
+    for (int index = 0; index < tree_size; ++index)
+        found += m.find(next_key(seed))->second;
+
+    state.set_items(tree_size);
+    benchmark::keep(found);
+}
+
+BENCH(map, erase)
+{
+    NS::map<int, int> m;
+
+    for (int index = 0; index < tree_size; ++index)
+        m.insert(m.end(), NS::make_pair(index, index));
+
+    state.reset_timer();
+
+    for (int index = 0; index < tree_size; index += 2)
+        m.erase(index);
+
+    state.set_items(tree_size / 2);
+    benchmark::keep(m.size());
+}
+
+BENCH(set, copy)
+{
+    NS::set<int> s;
+
+    for (int index = 0; index < tree_size; ++index)
+        s.insert(s.end(), index);
+
+    state.reset_timer();
+
+    NS::set<int> copy(s);
+
+    state.set_items(tree_size);
+    benchmark::keep(copy.size());
+}
+
+BENCH(set, iterate)
+{
+    NS::set<int> s;
+
+    for (int index = 0; index < tree_size; ++index)
+        s.insert(s.end(), index);
+
+    state.reset_timer();
+
+    long sum = 0;
+    for (NS::set<int>::iterator it = s.begin(); it != s.end(); ++it)
+        sum += *it;
+
+    state.set_items(tree_size);
+    benchmark::keep(sum);
+}
+
+// Lookups issued in batches of a few hundred keys against a tree well past
+// the last-level cache. std has no batched lookup: the std column of
+// set_find_batch runs std::set::find over each batch, and the one of
+// set_find_batch_vs_find the same loop over ft::rb_tree::find. The ft
+// column is rb_tree::find_batch in both.
+static const int batch_tree_size = 1 << 20;
+static const int batch_size = 256;
+
+// The insertion find_loop needs, spelled for both std::set and rb_tree.
+inline void insert_key(std::set<unsigned int> &tree, unsigned int k) { tree.insert(k); }
+
+inline void insert_key(ft::rb_tree<unsigned int> &tree, unsigned int k) { tree.insert_unique(k); }
+
+template <class Tree>
+class find_loop
+{
+public:
+    void insert(unsigned int k) { insert_key(_tree, k); }
+
+    std::size_t count_batch(const unsigned int *first, const unsigned int *last) const
+    {
+        std::size_t found = 0;
+        for (; first != last; ++first)
+            found += _tree.find(*first) != _tree.end();
+        return found;
+    }
+
+private:
+    Tree _tree;
+};
+
+class find_batch
+{
+public:
+    void insert(unsigned int k) { _tree.insert_unique(k); }
+
+    std::size_t count_batch(const unsigned int *first, const unsigned int *last) const
+    {
+        ft::rb_tree<unsigned int>::const_iterator results[batch_size];
+        const ft::rb_tree<unsigned int>::const_iterator *end = _tree.find_batch(first, last, results);
+        std::size_t found = 0;
+        for (const ft::rb_tree<unsigned int>::const_iterator *it = results; it != end; ++it)
+            found += *it != _tree.end();
+        return found;
+    }
+
+private:
+    ft::rb_tree<unsigned int> _tree;
+};
+
+template <class Table>
+static void run_batches(benchmark_state &state)
+{
+    Table table;
+    NS::vector<unsigned int> keys;
+    unsigned int seed = 42;
+    for (int index = 0; index < batch_tree_size; ++index)
+    {
+        keys.push_back(next_key(seed));
+        table.insert(keys.back());
+    }
+    // Probe order unrelated to insertion order; every other key misses.
+    for (int index = 0; index < batch_tree_size; ++index)
+        keys[index] = keys[(index * 7919u) % batch_tree_size] + (index & 1);
+
+    state.reset_timer();
+
+    unsigned long found = 0;
+    for (int index = 0; index < batch_tree_size; index += batch_size)
+        found += table.count_batch(&keys[index], &keys[index] + batch_size);
+
+    state.set_items(batch_tree_size);
+    benchmark::keep(found);
+}
+
+BENCH(set, find_batch)
+{
+    run_batches<ft::bench::pick<NS_TAG, find_loop<std::set<unsigned int> >, find_batch>::type>(state);
+}
+
+BENCH(set, find_batch_vs_find)
+{
+    run_batches<ft::bench::pick<NS_TAG, find_loop<ft::rb_tree<unsigned int> >, find_batch>::type>(state);
+}
+
+// Rebalancing between two workers that own adjacent key ranges: the top
+// quarter of the lower range moves to the upper worker and back. The std
+// column copies the range over and erases it; the ft column splits and
+// joins the rb_trees, which relinks the nodes instead (plain nodes, so each
+// split still walks the moved quarter to count it).
+static const int worker_keys = 1 << 17;
+static const int rebalance_rounds = 32;
+
+template <class T>
+class copying_owners
+{
+public:
+    void fill(T first, T last)
+    {
+        for (T k = first; k < first + (last - first) / 2; ++k)
+            _lower.insert(_lower.end(), k);
+        for (T k = first + (last - first) / 2; k < last; ++k)
+            _upper.insert(_upper.end(), k);
+    }
+
+    void move_up(const T &k)
+    {
+        typename std::set<T>::iterator first = _lower.lower_bound(k);
+        _upper.insert(first, _lower.end());
+        _lower.erase(first, _lower.end());
+    }
+
+    void move_down(const T &k)
+    {
+        typename std::set<T>::iterator last = _upper.lower_bound(k);
+        _lower.insert(_upper.begin(), last);
+        _upper.erase(_upper.begin(), last);
+    }
+
+    std::size_t size() const { return _lower.size() + _upper.size(); }
+
+private:
+    std::set<T> _lower;
+    std::set<T> _upper;
+};
+
+template <class T>
+class splitting_owners
+{
+public:
+    splitting_owners() : _lower(), _upper(std::less<T>(), _lower.get_allocator()) {}
+
+    void fill(T first, T last)
+    {
+        for (T k = first; k < first + (last - first) / 2; ++k)
+            _lower.insert_unique(_lower.end(), k);
+        for (T k = first + (last - first) / 2; k < last; ++k)
+            _upper.insert_unique(_upper.end(), k);
+    }
+
+    void move_up(const T &k)
+    {
+        ft::rb_tree<T> moved;
+        _lower.split(k, moved);
+        moved.join_unique(_upper);
+        _upper.swap(moved);
+    }
+
+    void move_down(const T &k)
+    {
+        ft::rb_tree<T> rest;
+        _upper.split(k, rest);
+        _lower.join_unique(_upper);
+        _upper.swap(rest);
+    }
+
+    std::size_t size() const { return _lower.size() + _upper.size(); }
+
+private:
+    ft::rb_tree<T> _lower;
+    ft::rb_tree<T> _upper;
+};
+
+BENCH(set, move_range)
+{
+    ft::bench::pick<NS_TAG, copying_owners<int>, splitting_owners<int> >::type owners;
+    owners.fill(0, worker_keys * 2);
+
+    state.reset_timer();
+
+    for (int round = 0; round < rebalance_rounds; ++round)
+    {
+        owners.move_up(worker_keys / 4 * 3);
+        owners.move_down(worker_keys);
+    }
+
+    state.set_items(static_cast<double>(rebalance_rounds) * 2 * (worker_keys / 4));
+    benchmark::keep(owners.size());
+}
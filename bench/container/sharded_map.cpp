@@ -0,0 +1,145 @@
+#include "benchmark.hpp"
+#include "container/sharded_map.hpp"
+#include <map>
+#include <pthread.h>
+
+static const int shared_keys = 1 << 16;
+static const int shared_operations = 1 << 18;
+
+// Without a sharded map, the std column is the usual fallback: one map
+// behind one reader-writer lock. The ft column is ft::sharded_map with 64
+// hash shards.
+template <class T>
+class locked_map
+{
+public:
+    locked_map() { pthread_rwlock_init(&_lock, NULL); }
+
+    ~locked_map() { pthread_rwlock_destroy(&_lock); }
+
+    bool assign(const T &k, const T &value)
+    {
+        pthread_rwlock_wrlock(&_lock);
+        const bool inserted = _map.count(k) == 0;
+        _map[k] = value;
+        pthread_rwlock_unlock(&_lock);
+        return inserted;
+    }
+
+    std::size_t erase(const T &k)
+    {
+        pthread_rwlock_wrlock(&_lock);
+        const std::size_t erased = _map.erase(k);
+        pthread_rwlock_unlock(&_lock);
+        return erased;
+    }
+
+    bool find(const T &k, T &out) const
+    {
+        pthread_rwlock_rdlock(&_lock);
+        typename std::map<T, T>::const_iterator it = _map.find(k);
+        const bool found = it != _map.end();
+        if (found)
+            out = it->second;
+        pthread_rwlock_unlock(&_lock);
+        return found;
+    }
+
+private:
+    mutable pthread_rwlock_t _lock;
+    std::map<T, T> _map;
+};
+
+template <class T>
+class sharded_map_64 : public ft::sharded_map<T, T>
+{
+public:
+    sharded_map_64() : ft::sharded_map<T, T>(ft::hash_partition<T>(64)) {}
+};
+
+typedef ft::bench::pick<NS_TAG, locked_map<int>, sharded_map_64<int> >::type map_type;
+
+struct mixed_context
+{
+    map_type *map;
+    int thread;
+    int operations;
+};
+
+// 80% lookups, 10% assignments, 10% erasures over a shared key space.
+static void *mixed_worker(void *argument)
+{
+    mixed_context *context = static_cast<mixed_context *>(argument);
+    unsigned int seed = 2654435761u * (context->thread + 1);
+    long found = 0;
+    int value;
+    for (int index = 0; index < context->operations; ++index)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const int key = static_cast<int>((seed >> 8) % shared_keys);
+        const unsigned int op = (seed >> 4) % 10;
+        if (op == 0)
+            context->map->assign(key, index);
+        else if (op == 1)
+            context->map->erase(key);
+        else
+            found += context->map->find(key, value);
+    }
+    benchmark::keep(found);
+    return NULL;
+}
+
+// The same total work split over @c threads threads, so the time per item
+// drops as far as the map lets the threads run in parallel.
+static void run_mixed(benchmark_state &state, int threads)
+{
+    map_type map;
+    for (int key = 0; key < shared_keys; key += 2)
+        map.assign(key, key);
+
+    pthread_t workers[32];
+    mixed_context contexts[32];
+
+    state.reset_timer();
+    for (int thread = 0; thread < threads; ++thread)
+    {
+        contexts[thread].map = &map;
+        contexts[thread].thread = thread;
+        contexts[thread].operations = shared_operations / threads;
+        pthread_create(&workers[thread], NULL, mixed_worker, &contexts[thread]);
+    }
+    for (int thread = 0; thread < threads; ++thread)
+        pthread_join(workers[thread], NULL);
+
+    state.set_items(shared_operations);
+}
+
+BENCH(sharded_map, threads_01)
+{
+    run_mixed(state, 1);
+}
+
+BENCH(sharded_map, threads_02)
+{
+    run_mixed(state, 2);
+}
+
+BENCH(sharded_map, threads_04)
+{
+    run_mixed(state, 4);
+}
+
+BENCH(sharded_map, threads_08)
+{
+    run_mixed(state, 8);
+}
+
+BENCH(sharded_map, threads_16)
+{
+    run_mixed(state, 16);
+}
+
+BENCH(sharded_map, threads_32)
+{
+    run_mixed(state, 32);
+}
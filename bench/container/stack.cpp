@@ -0,0 +1,39 @@
+#include "benchmark.hpp"
+#include "container/stack.hpp"
+#include "container/deque.hpp"
+#include <stack>
+#include <deque>
+
+BENCH(stack, churn)
+{
+    NS::stack<int> s;
+    long sum = 0;
+
+    // Grow and shrink in waves so both push and pop paths stay hot.
+    for (int wave = 0; wave < 64; ++wave)
+    {
+        for (int index = 0; index < 8192; ++index)
+            s.push(index);
+        for (int index = 0; index < 6144; ++index)
+        {
+            sum += s.top();
+            s.pop();
+        }
+    }
+
+    state.set_items(64 * (8192 + 6144));
+    benchmark::keep(sum);
+}
+
+// One deep stack built from empty: the vector-backed stack copies all of
+// its elements at every reallocation, the deque-backed one never does.
+BENCH(stack, deep_growth_deque)
+{
+    NS::stack<int, NS::deque<int> > s;
+
+    for (int index = 0; index < 1 << 20; ++index)
+        s.push(index);
+
+    state.set_items(1 << 20);
+    benchmark::keep(s.top());
+}
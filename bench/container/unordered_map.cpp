@@ -0,0 +1,121 @@
+#include "benchmark.hpp"
+#include "container/map.hpp"
+#include "container/unordered_map.hpp"
+#include <map>
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#else
+#include <tr1/unordered_map>
+#endif
+
+static const int table_size = 1 << 18;
+
+static unsigned int next_key(unsigned int &seed)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 4;
+}
+
+// The std column is the library's own hash map (std::tr1 before C++11).
+#if __cplusplus >= 201103L
+typedef std::unordered_map<unsigned int, unsigned int> std_hash_map;
+#else
+typedef std::tr1::unordered_map<unsigned int, unsigned int> std_hash_map;
+#endif
+
+typedef ft::bench::pick<NS_TAG, std_hash_map, ft::unordered_map<unsigned int, unsigned int> >::type map_type;
+
+template <class Map>
+static void fill(Map &m)
+{
+    unsigned int seed = 42;
+    for (int index = 0; index < table_size; ++index)
+        m.insert(typename Map::value_type(next_key(seed), index));
+}
+
+// Looks every inserted key up again, in insertion order.
+template <class Map>
+static void find_hits(benchmark_state &state)
+{
+    Map m;
+    fill(m);
+
+    state.reset_timer();
+
+    unsigned int seed = 42;
+    unsigned long found = 0;
+    for (int index = 0; index < table_size; ++index)
+        found += m.find(next_key(seed))->second;
+
+    state.set_items(table_size);
+    benchmark::keep(found);
+}
+
+BENCH(unordered_map, insert_random)
+{
+    map_type m;
+    fill(m);
+
+    state.set_items(table_size);
+    benchmark::keep(m.size());
+}
+
+BENCH(unordered_map, insert_reserved)
+{
+    map_type m;
+    // reserve(), spelled so that std::tr1 has it too.
+    m.rehash(static_cast<std::size_t>(table_size / m.max_load_factor()) + 1);
+    fill(m);
+
+    state.set_items(table_size);
+    benchmark::keep(m.size());
+}
+
+BENCH(unordered_map, find)
+{
+    find_hits<map_type>(state);
+}
+
+BENCH(unordered_map, find_miss)
+{
+    map_type m;
+    fill(m);
+
+    state.reset_timer();
+
+    unsigned int seed = 7;
+    unsigned long found = 0;
+    for (int index = 0; index < table_size; ++index)
+        found += m.count(next_key(seed) | 0x80000000u);
+
+    state.set_items(table_size);
+    benchmark::keep(found);
+}
+
+BENCH(unordered_map, erase)
+{
+    map_type m;
+    fill(m);
+
+    state.reset_timer();
+
+    unsigned int seed = 42;
+    unsigned long erased = 0;
+    for (int index = 0; index < table_size; ++index)
+        erased += m.erase(next_key(seed));
+
+    state.set_items(table_size);
+    benchmark::keep(erased);
+}
+
+// Same ft column against the ordered maps these lookups use today: std::map
+// in the first row, ft::map (ft::rb_tree) in the second.
+BENCH(unordered_map, find_vs_std_map)
+{
+    find_hits<ft::bench::pick<NS_TAG, std::map<unsigned int, unsigned int>, map_type>::type>(state);
+}
+
+BENCH(unordered_map, find_vs_rb_tree)
+{
+    find_hits<ft::bench::pick<NS_TAG, ft::map<unsigned int, unsigned int>, map_type>::type>(state);
+}
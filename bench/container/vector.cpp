@@ -0,0 +1,126 @@
+#include "benchmark.hpp"
+#include "container/vector.hpp"
+#include "container/small_vector.hpp"
+#include <vector>
+#include <string>
+
+static const int vector_size = 1 << 20;
+
+BENCH(vector, push_back)
+{
+    NS::vector<int> v;
+
+    for (int index = 0; index < vector_size; ++index)
+        v.push_back(index);
+
+    state.set_items(vector_size);
+    benchmark::keep(v.back());
+}
+
+BENCH(vector, push_back_string)
+{
+    NS::vector<std::string> v;
+
+    for (int index = 0; index < vector_size / 16; ++index)
+        v.push_back("a string long enough to live on the heap");
+
+    state.set_items(vector_size / 16);
+    benchmark::keep(v.back());
+}
+
+BENCH(vector, copy)
+{
+    NS::vector<int> v(vector_size, 42);
+
+    state.reset_timer();
+
+    NS::vector<int> copy(v);
+
+    state.set_items(vector_size);
+    benchmark::keep(copy.back());
+}
+
+BENCH(vector, insert_front)
+{
+    NS::vector<int> v;
+
+    for (int index = 0; index < 4096; ++index)
+        v.insert(v.begin(), index);
+
+    state.set_items(4096);
+    benchmark::keep(v.front());
+}
+
+BENCH(vector, iterate)
+{
+    NS::vector<int> v(vector_size, 1);
+
+    state.reset_timer();
+
+    long sum = 0;
+    for (NS::vector<int>::iterator it = v.begin(); it != v.end(); ++it)
+        sum += *it;
+
+    state.set_items(vector_size);
+    benchmark::keep(sum);
+}
+
+// Snapshot diffing: equal vectors (full scan) and a late difference.
+BENCH(vector, compare_int)
+{
+    NS::vector<int> a;
+    for (int index = 0; index < vector_size; ++index)
+        a.push_back(index);
+    NS::vector<int> b(a);
+    NS::vector<int> c(a);
+    c[vector_size - 10] = -1;
+
+    state.reset_timer();
+
+    int result = 0;
+    for (int round = 0; round < 16; ++round)
+        result += (a == b) + (c < a) + (a < b);
+
+    state.set_items(static_cast<long>(vector_size) * 16 * 3);
+    benchmark::keep(result);
+}
+
+BENCH(vector, compare_double)
+{
+    NS::vector<double> a;
+    for (int index = 0; index < vector_size; ++index)
+        a.push_back(index * 0.5);
+    NS::vector<double> b(a);
+    NS::vector<double> c(a);
+    c[vector_size - 10] = -1.0;
+
+    state.reset_timer();
+
+    int result = 0;
+    for (int round = 0; round < 16; ++round)
+        result += (a == b) + (c < a) + (a < b);
+
+    state.set_items(static_cast<long>(vector_size) * 16 * 3);
+    benchmark::keep(result);
+}
+
+// std has no small-buffer vector: the std column is the plain std::vector
+// that ft::small_vector replaces for short sequences.
+typedef ft::bench::pick<NS_TAG, std::vector<int>, ft::small_vector<int, 8> >::type small_buffer;
+
+BENCH(vector, small_short_lived)
+{
+    long sum = 0;
+
+    // Many short sequences (1 to 8 elements), each built and dropped.
+    for (int index = 0; index < vector_size / 4; ++index)
+    {
+        small_buffer v;
+        for (int element = 0; element <= (index & 7); ++element)
+            v.push_back(element);
+        sum += v.back();
+    }
+
+    state.set_items(vector_size / 4);
+    benchmark::keep(sum);
+}
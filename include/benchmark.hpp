@@ -0,0 +1,108 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <map>
+#include <string>
+#include <time.h>
+
+#include "perf_counters.hpp"
+
+// Per-run handle passed to every benchmark body.
+struct benchmark_state
+{
+    struct timespec start;
+
+    double items;
+
+    // Set by the runner when hardware counters were requested (-p).
+    perf_counters *counters;
+
+    benchmark_state() : start(), items(), counters() {}
+
+    /// Excludes everything done so far (setup) from the measured time and
+    /// from the hardware counters.
+    void reset_timer()
+    {
+        if (counters != NULL)
+            counters->start();
+        clock_gettime(CLOCK_MONOTONIC, &start);
+    }
+
+    /// Number of items processed by one run, used for the throughput column.
+    void set_items(double count) { items = count; }
+};
+
+struct benchmark
+{
+    typedef void (*bench_function)(benchmark_state &);
+
+    // benchmark name -> namespace it was compiled for -> function
+    typedef std::map<std::string, std::map<std::string, bench_function> > registry;
+
+    static registry &benches();
+    static bool register_bench(std::string name, std::string ns, bench_function function);
+    static int run(int argc, char **argv);
+
+    /// Forces the compiler to materialize @c value so the work producing it
+    /// cannot be optimized away.
+    template <typename T>
+    static void keep(const T &value)
+    {
+        asm volatile("" : : "r"(&value) : "memory");
+    }
+};
+
+#ifndef NS
+#define NS foo
+#endif
+
+namespace ft
+{
+    namespace bench
+    {
+        struct std_tag
+        {
+        };
+
+        struct ft_tag
+        {
+        };
+
+        /// @c StdImpl in the std build of a benchmark and @c FtImpl in the ft
+        /// one, for benchmarks whose two columns are not the same NS::
+        /// template: pick<NS_TAG, StdImpl, FtImpl>::type.
+        template <class Tag, class StdImpl, class FtImpl>
+        struct pick;
+
+        template <class StdImpl, class FtImpl>
+        struct pick<std_tag, StdImpl, FtImpl>
+        {
+            typedef StdImpl type;
+        };
+
+        template <class StdImpl, class FtImpl>
+        struct pick<ft_tag, StdImpl, FtImpl>
+        {
+            typedef FtImpl type;
+        };
+    }
+}
+
+#define NS_TAG3(ns) ft::bench::ns##_tag
+#define NS_TAG2(ns) NS_TAG3(ns)
+#define NS_TAG NS_TAG2(NS)
+
+#define BENCH2(a, b, ns)                                                                                                 \
+    struct bench_##a##_##b##ns                                                                                           \
+    {                                                                                                                    \
+        static bool isRegistered;                                                                                        \
+        static void run(benchmark_state &state);                                                                         \
+    };                                                                                                                   \
+    bool bench_##a##_##b##ns::isRegistered = benchmark::register_bench(#a "_" #b, #ns, bench_##a##_##b##ns::run);       \
+    void bench_##a##_##b##ns::run(benchmark_state &state)
+
+#define BENCH3(a, b, ns) BENCH2(a, b, ns)
+
+#define BENCH(a, b) BENCH3(a, b, NS)
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef CONCURRENT_STACK_HPP
+#define CONCURRENT_STACK_HPP
+
+#include <cstddef>
+#include <new>
+
+#include "memory/pool_allocator.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Lock-free LIFO (Treiber stack) for sharing work items or free
+     * lists between threads, where ft::stack would need an external mutex.
+     *
+     * Nodes are addressed by 32-bit indices and the head is a 64-bit word
+     * holding the top index plus a tag bumped by every successful swap, so
+     * a head that was popped and pushed back in between (ABA) fails the
+     * compare-and-swap. Reclamation is type-stable: a popped node goes to an
+     * internal lock-free free list and is only reused as a node of this
+     * stack, never freed before the stack is destroyed. A thread that reads
+     * a stale node's link therefore reads valid memory, and its CAS fails on
+     * the tag, with no hazard pointers or epochs to maintain.
+     *
+     * Node storage comes from Alloc in segments of geometrically growing
+     * size (the first holds 64 nodes), allocated under a short spin lock the
+     * first time an index in them is handed out; push/pop never lock.
+     */
+    template <class T, class Alloc = ft::pool_allocator<T> >
+    class concurrent_stack
+    {
+    public:
+        typedef T value_type;
+
+        typedef Alloc allocator_type;
+
+        typedef std::size_t size_type;
+
+    private:
+        typedef unsigned int index_type;
+
+        typedef unsigned long long word_type;
+
+        struct node
+        {
+            T value;
+            index_type next;
+        };
+
+        typedef typename Alloc::template rebind<node>::other node_allocator_type;
+
+        static const size_type first_segment = 64;
+
+        static const size_type segment_count = 26;
+
+        word_type _head;
+
+        word_type _free;
+
+        index_type _fresh;
+
+        int _lock;
+
+        node *_segments[segment_count];
+
+        node_allocator_type _allocator;
+
+        concurrent_stack(const concurrent_stack &);
+
+        concurrent_stack &operator=(const concurrent_stack &);
+
+    public:
+        explicit concurrent_stack(const allocator_type &alloc = allocator_type())
+            : _head(0), _free(0), _fresh(0), _lock(0), _allocator(alloc)
+        {
+            for (size_type s = 0; s < segment_count; ++s)
+                _segments[s] = NULL;
+        }
+
+        // Must not race with other operations.
+        ~concurrent_stack()
+        {
+            for (index_type index = index_of(_head); index != 0; index = at(index)->next)
+                at(index)->value.~T();
+            for (size_type s = 0; s < segment_count; ++s)
+                if (_segments[s] != NULL)
+                    _allocator.deallocate(_segments[s], first_segment << s);
+        }
+
+        bool empty() const
+        {
+            return index_of(__atomic_load_n(&_head, __ATOMIC_ACQUIRE)) == 0;
+        }
+
+        void push(const value_type &value)
+        {
+            const index_type index = take_node();
+            try
+            {
+                ::new (static_cast<void *>(&at(index)->value)) T(value);
+            }
+            catch (...)
+            {
+                link(_free, index);
+                throw;
+            }
+            link(_head, index);
+        }
+
+        /**
+         * Pops the top element into @c out; false when the stack was empty.
+         * If assigning to @c out throws, the element is pushed back before
+         * the exception propagates.
+         */
+        bool try_pop(value_type &out)
+        {
+            const index_type index = unlink(_head);
+            if (index == 0)
+                return false;
+            node *n = at(index);
+            try
+            {
+                out = n->value;
+            }
+            catch (...)
+            {
+                link(_head, index);
+                throw;
+            }
+            n->value.~T();
+            link(_free, index);
+            return true;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return allocator_type(_allocator);
+        }
+
+    private:
+        static index_type index_of(word_type word)
+        {
+            return static_cast<index_type>(word);
+        }
+
+        static word_type next_word(word_type word, index_type index)
+        {
+            return (((word >> 32) + 1) << 32) | index;
+        }
+
+        // Index i (1-based) lives in segment s = floor(log2((i - 1) / 64 + 1)).
+        node *at(index_type index) const
+        {
+            const size_type slot = index - 1;
+            size_type s = 0;
+            while (slot >= first_segment * ((static_cast<size_type>(2) << s) - 1))
+                ++s;
+            node *segment = __atomic_load_n(&_segments[s], __ATOMIC_ACQUIRE);
+            return segment + (slot - first_segment * ((static_cast<size_type>(1) << s) - 1));
+        }
+
+        void link(word_type &list, index_type index)
+        {
+            node *n = at(index);
+            word_type head = __atomic_load_n(&list, __ATOMIC_RELAXED);
+            do
+                __atomic_store_n(&n->next, index_of(head), __ATOMIC_RELAXED);
+            while (!__atomic_compare_exchange_n(&list, &head, next_word(head, index), true,
+                                                __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+        }
+
+        index_type unlink(word_type &list)
+        {
+            word_type head = __atomic_load_n(&list, __ATOMIC_ACQUIRE);
+            for (;;)
+            {
+                const index_type index = index_of(head);
+                if (index == 0)
+                    return 0;
+                // The node may be popped and relinked concurrently: the read
+                // is still of a live node and the tag then fails the swap.
+                const index_type next = __atomic_load_n(&at(index)->next, __ATOMIC_RELAXED);
+                if (__atomic_compare_exchange_n(&list, &head, next_word(head, next), true,
+                                                __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+                    return index;
+            }
+        }
+
+        index_type take_node()
+        {
+            const index_type reused = unlink(_free);
+            if (reused != 0)
+                return reused;
+
+            const index_type index = __atomic_add_fetch(&_fresh, 1, __ATOMIC_RELAXED);
+            const size_type slot = index - 1;
+            size_type s = 0;
+            while (slot >= first_segment * ((static_cast<size_type>(2) << s) - 1))
+                ++s;
+            if (index == 0 || s >= segment_count)
+                throw std::bad_alloc();
+            if (__atomic_load_n(&_segments[s], __ATOMIC_ACQUIRE) == NULL)
+                allocate_segment(s);
+            return index;
+        }
+
+        void allocate_segment(size_type s)
+        {
+            while (__atomic_exchange_n(&_lock, 1, __ATOMIC_ACQUIRE) != 0)
+                while (__atomic_load_n(&_lock, __ATOMIC_RELAXED) != 0)
+                    ;
+            try
+            {
+                if (_segments[s] == NULL)
+                    __atomic_store_n(&_segments[s], _allocator.allocate(first_segment << s), __ATOMIC_RELEASE);
+            }
+            catch (...)
+            {
+                __atomic_store_n(&_lock, 0, __ATOMIC_RELEASE);
+                throw;
+            }
+            __atomic_store_n(&_lock, 0, __ATOMIC_RELEASE);
+        }
+    };
+
+}
+
+#endif
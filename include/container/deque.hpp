@@ -0,0 +1,528 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+#include "util/type_traits.hpp"
+
+#include "iterator/deque_iterator.hpp"
+
+#include "iterator/reverse_iterator.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Double-ended queue stored as fixed-size chunks (one page each)
+     * reached through a map of chunk pointers.
+     *
+     * Growing at either end fills the edge chunk, then allocates one more:
+     * elements are never copied or moved, so references to them stay valid
+     * across push_back / push_front. Only the chunk map is ever reallocated;
+     * it holds one pointer per chunk and at least doubles when it fills, so
+     * a push is amortized O(1), with an O(size / chunk) worst case when the
+     * map is re-centred or copied. The last chunk released by a pop is kept
+     * as a spare, so a stack oscillating around a chunk boundary does not hit
+     * the allocator on every push and pop. Use it as ft::stack's Container
+     * to avoid the copy-everything reallocations of ft::vector.
+     */
+    template <class T, class Allocator = std::allocator<T> >
+    class deque
+    {
+    public:
+        typedef T value_type;
+
+        typedef Allocator allocator_type;
+
+        typedef typename allocator_type::reference reference;
+
+        typedef typename allocator_type::const_reference const_reference;
+
+        typedef typename allocator_type::pointer pointer;
+
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef typename ft::deque_iterator<value_type> iterator;
+
+        typedef typename ft::deque_iterator<const value_type> const_iterator;
+
+        typedef typename ft::reverse_iterator<iterator> reverse_iterator;
+
+        typedef typename ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        typedef typename allocator_type::difference_type difference_type;
+
+        typedef typename allocator_type::size_type size_type;
+
+    private:
+        typedef typename iterator::map_pointer map_pointer;
+
+        typedef typename Allocator::template rebind<pointer>::other map_allocator_type;
+
+    public:
+        explicit deque(const allocator_type &alloc = allocator_type())
+            : _alloc(alloc), _map(), _map_size(0), _spare(), _start(), _finish() {};
+
+        explicit deque(size_type n, const_reference val = value_type(), const allocator_type &alloc = allocator_type())
+            : _alloc(alloc), _map(), _map_size(0), _spare(), _start(), _finish()
+        {
+            assign(n, val);
+        };
+
+        template <class InputIterator>
+        deque(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
+              typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL)
+            : _alloc(alloc), _map(), _map_size(0), _spare(), _start(), _finish()
+        {
+            assign(first, last);
+        };
+
+        deque(const deque &x) : _alloc(x._alloc), _map(), _map_size(0), _spare(), _start(), _finish()
+        {
+            assign(x.begin(), x.end());
+        };
+
+        deque &operator=(const deque &other)
+        {
+            if (this != &other)
+                assign(other.begin(), other.end());
+            return *this;
+        };
+
+#if __cplusplus >= 201103L
+        deque(deque &&x) noexcept
+            : _alloc(std::move(x._alloc)), _map(x._map), _map_size(x._map_size), _spare(x._spare),
+              _start(x._start), _finish(x._finish)
+        {
+            x._map = map_pointer();
+            x._map_size = 0;
+            x._spare = pointer();
+            x._start = iterator();
+            x._finish = iterator();
+        };
+
+        deque &operator=(deque &&other) noexcept
+        {
+            deque released(std::move(other));
+            swap(released);
+            return *this;
+        };
+#endif
+
+        ~deque()
+        {
+            clear();
+            if (_map == map_pointer())
+                return;
+            _alloc.deallocate(*_start.node(), chunk_size());
+            release_spare();
+            map_allocator_type(_alloc).deallocate(_map, _map_size);
+        };
+
+        iterator begin() { return _start; };
+
+        iterator end() { return _finish; };
+
+        const_iterator begin() const { return const_iterator(_start); };
+
+        const_iterator end() const { return const_iterator(_finish); };
+
+        reverse_iterator rbegin() { return reverse_iterator(end()); };
+
+        reverse_iterator rend() { return reverse_iterator(begin()); };
+
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); };
+
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); };
+
+        size_type size() const { return _map == map_pointer() ? 0 : _finish - _start; };
+
+        size_type max_size() const { return _alloc.max_size(); };
+
+        bool empty() const { return _finish == _start; };
+
+        void resize(size_type n, const_reference val = value_type())
+        {
+            const value_type copy(val);
+            while (size() > n)
+                pop_back();
+            while (size() < n)
+                push_back(copy);
+        };
+
+        reference operator[](size_type n) { return _start[n]; };
+
+        const_reference operator[](size_type n) const { return begin()[n]; };
+
+        reference at(size_type n)
+        {
+            if (n >= size())
+                throw std::out_of_range("deque::at");
+            return _start[n];
+        };
+
+        const_reference at(size_type n) const
+        {
+            if (n >= size())
+                throw std::out_of_range("deque::at");
+            return begin()[n];
+        };
+
+        reference front() { return *_start; };
+
+        const_reference front() const { return *_start; };
+
+        reference back() { return *(_finish - 1); };
+
+        const_reference back() const { return *(end() - 1); };
+
+        template <class InputIterator>
+        void assign(InputIterator first, InputIterator last,
+                    typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL)
+        {
+            clear();
+            for (; first != last; ++first)
+                push_back(*first);
+        };
+
+        void assign(size_type n, const value_type &val)
+        {
+            const value_type copy(val);
+            clear();
+            for (; n != 0; --n)
+                push_back(copy);
+        };
+
+        void push_back(const_reference val)
+        {
+            if (_map == map_pointer())
+                initialize_map();
+            if (_finish.base() + 1 != _finish.chunk_end())
+            {
+                ::new (static_cast<void *>(_finish.base())) value_type(val);
+                _finish.set_cur(_finish.base() + 1);
+                return;
+            }
+
+            // The new element fills the last slot of its chunk: make sure the
+            // next chunk exists first so that end() always has a home.
+            reserve_map_at_back();
+            *(_finish.node() + 1) = take_chunk();
+            try
+            {
+                ::new (static_cast<void *>(_finish.base())) value_type(val);
+            }
+            catch (...)
+            {
+                give_back_chunk(*(_finish.node() + 1));
+                *(_finish.node() + 1) = pointer();
+                throw;
+            }
+            _finish.set_node(_finish.node() + 1);
+            _finish.set_cur(_finish.chunk_begin());
+        }
+
+        void push_front(const_reference val)
+        {
+            if (_map == map_pointer())
+                initialize_map();
+            if (_start.base() != _start.chunk_begin())
+            {
+                ::new (static_cast<void *>(_start.base() - 1)) value_type(val);
+                _start.set_cur(_start.base() - 1);
+                return;
+            }
+
+            reserve_map_at_front();
+            *(_start.node() - 1) = take_chunk();
+            try
+            {
+                ::new (static_cast<void *>(*(_start.node() - 1) + chunk_size() - 1)) value_type(val);
+            }
+            catch (...)
+            {
+                give_back_chunk(*(_start.node() - 1));
+                *(_start.node() - 1) = pointer();
+                throw;
+            }
+            _start.set_node(_start.node() - 1);
+            _start.set_cur(_start.chunk_end() - 1);
+        }
+
+#if __cplusplus >= 201103L
+        void push_back(value_type &&val) { emplace_back(std::move(val)); };
+
+        void push_front(value_type &&val) { emplace_front(std::move(val)); };
+
+        template <class... Args>
+        void emplace_back(Args &&...args)
+        {
+            if (_map == map_pointer())
+                initialize_map();
+            if (_finish.base() + 1 != _finish.chunk_end())
+            {
+                ::new (static_cast<void *>(_finish.base())) value_type(std::forward<Args>(args)...);
+                _finish.set_cur(_finish.base() + 1);
+                return;
+            }
+            reserve_map_at_back();
+            *(_finish.node() + 1) = take_chunk();
+            try
+            {
+                ::new (static_cast<void *>(_finish.base())) value_type(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                give_back_chunk(*(_finish.node() + 1));
+                *(_finish.node() + 1) = pointer();
+                throw;
+            }
+            _finish.set_node(_finish.node() + 1);
+            _finish.set_cur(_finish.chunk_begin());
+        };
+
+        template <class... Args>
+        void emplace_front(Args &&...args)
+        {
+            if (_map == map_pointer())
+                initialize_map();
+            if (_start.base() != _start.chunk_begin())
+            {
+                ::new (static_cast<void *>(_start.base() - 1)) value_type(std::forward<Args>(args)...);
+                _start.set_cur(_start.base() - 1);
+                return;
+            }
+            reserve_map_at_front();
+            *(_start.node() - 1) = take_chunk();
+            try
+            {
+                ::new (static_cast<void *>(*(_start.node() - 1) + chunk_size() - 1)) value_type(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                give_back_chunk(*(_start.node() - 1));
+                *(_start.node() - 1) = pointer();
+                throw;
+            }
+            _start.set_node(_start.node() - 1);
+            _start.set_cur(_start.chunk_end() - 1);
+        };
+#endif
+
+        void pop_back()
+        {
+            if (empty())
+                throw std::out_of_range("ft::deque::pop_back");
+            if (_finish.base() == _finish.chunk_begin())
+            {
+                give_back_chunk(*_finish.node());
+                *_finish.node() = pointer();
+                _finish.set_node(_finish.node() - 1);
+                _finish.set_cur(_finish.chunk_end());
+            }
+            _finish.set_cur(_finish.base() - 1);
+            _finish->~value_type();
+        }
+
+        void pop_front()
+        {
+            if (empty())
+                throw std::out_of_range("ft::deque::pop_front");
+            _start->~value_type();
+            if (_start.base() + 1 != _start.chunk_end())
+            {
+                _start.set_cur(_start.base() + 1);
+                return;
+            }
+            give_back_chunk(*_start.node());
+            *_start.node() = pointer();
+            _start.set_node(_start.node() + 1);
+            _start.set_cur(_start.chunk_begin());
+        }
+
+        void swap(deque &other)
+        {
+            std::swap(_alloc, other._alloc);
+            std::swap(_map, other._map);
+            std::swap(_map_size, other._map_size);
+            std::swap(_spare, other._spare);
+            std::swap(_start, other._start);
+            std::swap(_finish, other._finish);
+        };
+
+        // Destroys every element and keeps a single chunk, like a fresh deque
+        // that has seen one push.
+        void clear()
+        {
+            if (_map == map_pointer())
+                return;
+            for (map_pointer node = _start.node(); node != _finish.node() + 1; ++node)
+            {
+                pointer first = node == _start.node() ? _start.base() : *node;
+                pointer last = node == _finish.node() ? _finish.base() : *node + chunk_size();
+                for (; first != last; ++first)
+                    first->~value_type();
+                if (node != _start.node())
+                {
+                    _alloc.deallocate(*node, chunk_size());
+                    *node = pointer();
+                }
+            }
+            _finish = _start = iterator(*_start.node(), _start.node());
+        };
+
+        allocator_type get_allocator() const { return _alloc; };
+
+    private:
+        static size_type chunk_size()
+        {
+            return ft::__deque_chunk_size(sizeof(value_type));
+        }
+
+        // One chunk in the middle of a small map, so both ends can grow.
+        void initialize_map()
+        {
+            _map_size = 8;
+            _map = map_allocator_type(_alloc).allocate(_map_size);
+            std::fill(_map, _map + _map_size, pointer());
+            const map_pointer node = _map + _map_size / 2;
+            *node = take_chunk();
+            _finish = _start = iterator(*node, node);
+        }
+
+        pointer take_chunk()
+        {
+            if (_spare == pointer())
+                return _alloc.allocate(chunk_size());
+            const pointer chunk = _spare;
+            _spare = pointer();
+            return chunk;
+        }
+
+        void give_back_chunk(pointer chunk)
+        {
+            release_spare();
+            _spare = chunk;
+        }
+
+        void release_spare()
+        {
+            if (_spare != pointer())
+                _alloc.deallocate(_spare, chunk_size());
+            _spare = pointer();
+        }
+
+        void reserve_map_at_back()
+        {
+            if (_finish.node() + 1 == _map + _map_size)
+                reallocate_map(false);
+        }
+
+        void reserve_map_at_front()
+        {
+            if (_start.node() == _map)
+                reallocate_map(true);
+        }
+
+        // Makes room for one more chunk pointer at the requested end: the
+        // used slots are re-centred when the map is less than half full and
+        // copied into a map twice as large otherwise. Only chunk pointers
+        // move; elements stay where they are.
+        void reallocate_map(bool add_at_front)
+        {
+            const size_type old_nodes = _finish.node() - _start.node() + 1;
+            const size_type new_nodes = old_nodes + 1;
+            map_pointer new_start;
+            if (_map_size > 2 * new_nodes)
+            {
+                new_start = _map + (_map_size - new_nodes) / 2 + (add_at_front ? 1 : 0);
+                if (new_start < _start.node())
+                    std::copy(_start.node(), _finish.node() + 1, new_start);
+                else
+                    std::copy_backward(_start.node(), _finish.node() + 1, new_start + old_nodes);
+                std::fill(_map, new_start, pointer());
+                std::fill(new_start + old_nodes, _map + _map_size, pointer());
+            }
+            else
+            {
+                const size_type new_map_size = _map_size * 2 + 2;
+                map_allocator_type map_alloc(_alloc);
+                const map_pointer new_map = map_alloc.allocate(new_map_size);
+                std::fill(new_map, new_map + new_map_size, pointer());
+                new_start = new_map + (new_map_size - new_nodes) / 2 + (add_at_front ? 1 : 0);
+                std::copy(_start.node(), _finish.node() + 1, new_start);
+                map_alloc.deallocate(_map, _map_size);
+                _map = new_map;
+                _map_size = new_map_size;
+            }
+            const difference_type start_offset = _start.base() - _start.chunk_begin();
+            const difference_type finish_offset = _finish.base() - _finish.chunk_begin();
+            _start.set_node(new_start);
+            _start.set_cur(_start.chunk_begin() + start_offset);
+            _finish.set_node(new_start + old_nodes - 1);
+            _finish.set_cur(_finish.chunk_begin() + finish_offset);
+        }
+
+        allocator_type _alloc;
+
+        map_pointer _map;
+
+        size_type _map_size;
+
+        pointer _spare;
+
+        iterator _start;
+
+        iterator _finish;
+    };
+
+    template <class T, class Alloc>
+    bool operator==(const deque<T, Alloc> &lhs, const deque<T, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T, class Alloc>
+    bool operator!=(const deque<T, Alloc> &lhs, const deque<T, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class Alloc>
+    bool operator<(const deque<T, Alloc> &lhs, const deque<T, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T, class Alloc>
+    bool operator<=(const deque<T, Alloc> &lhs, const deque<T, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, class Alloc>
+    bool operator>(const deque<T, Alloc> &lhs, const deque<T, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, class Alloc>
+    bool operator>=(const deque<T, Alloc> &lhs, const deque<T, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, class Alloc>
+    void swap(deque<T, Alloc> &x, deque<T, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
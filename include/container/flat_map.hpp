@@ -0,0 +1,203 @@
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include "container/vector.hpp"
+
+#include "tree/flat_tree.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/pair.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Map with unique keys whose (key, value) pairs are kept sorted in
+     * a contiguous Container; see ft::flat_set. Elements move when others
+     * are inserted or erased, so the key of value_type is not const: it must
+     * not be modified through an iterator.
+     */
+    template <class Key, class T, class Compare = std::less<Key>, class Container = ft::vector<ft::pair<Key, T> > >
+    class flat_map
+    {
+    public:
+        typedef Key key_type;
+
+        typedef T mapped_type;
+
+        typedef ft::pair<Key, T> value_type;
+
+        typedef Compare key_compare;
+
+        typedef Container container_type;
+
+        typedef typename Container::size_type size_type;
+
+        typedef typename Container::difference_type difference_type;
+
+    private:
+        typedef ft::flat_tree<value_type, Compare, ft::select_first<value_type>, Container> tree_type;
+
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::value_compare value_compare;
+
+        typedef typename tree_type::iterator iterator;
+
+        typedef typename tree_type::const_iterator const_iterator;
+
+        typedef typename tree_type::reverse_iterator reverse_iterator;
+
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+        explicit flat_map(const key_compare &comp = key_compare()) : _tree(comp) {};
+
+        template <class InputIterator>
+        flat_map(InputIterator first, InputIterator last, const key_compare &comp = key_compare()) : _tree(comp)
+        {
+            _tree.insert_unique(first, last);
+        };
+
+        iterator begin() { return _tree.begin(); };
+
+        const_iterator begin() const { return _tree.begin(); };
+
+        iterator end() { return _tree.end(); };
+
+        const_iterator end() const { return _tree.end(); };
+
+        reverse_iterator rbegin() { return _tree.rbegin(); };
+
+        const_reverse_iterator rbegin() const { return _tree.rbegin(); };
+
+        reverse_iterator rend() { return _tree.rend(); };
+
+        const_reverse_iterator rend() const { return _tree.rend(); };
+
+        bool empty() const { return _tree.empty(); };
+
+        size_type size() const { return _tree.size(); };
+
+        size_type max_size() const { return _tree.max_size(); };
+
+        size_type capacity() const { return _tree.capacity(); };
+
+        void reserve(size_type n) { _tree.reserve(n); };
+
+        mapped_type &operator[](const key_type &k)
+        {
+            iterator it = _tree.lower_bound(k);
+            if (it == end() || key_comp()(k, it->first))
+                it = _tree.insert_unique(it, value_type(k, mapped_type()));
+            return it->second;
+        };
+
+        mapped_type &at(const key_type &k)
+        {
+            iterator it = _tree.find(k);
+            if (it == end())
+                throw std::out_of_range("flat_map::at");
+            return it->second;
+        };
+
+        const mapped_type &at(const key_type &k) const
+        {
+            const_iterator it = _tree.find(k);
+            if (it == end())
+                throw std::out_of_range("flat_map::at");
+            return it->second;
+        };
+
+        ft::pair<iterator, bool> insert(const value_type &val) { return _tree.insert_unique(val); };
+
+        iterator insert(const_iterator position, const value_type &val) { return _tree.insert_unique(position, val); };
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last) { _tree.insert_unique(first, last); };
+
+        iterator erase(const_iterator position) { return _tree.erase(position); };
+
+        size_type erase(const key_type &k) { return _tree.erase(k); };
+
+        iterator erase(const_iterator first, const_iterator last) { return _tree.erase(first, last); };
+
+        void swap(flat_map &x) { _tree.swap(x._tree); };
+
+        void clear() { _tree.clear(); };
+
+        key_compare key_comp() const { return _tree.get_comparator(); };
+
+        value_compare value_comp() const { return value_compare(key_comp()); };
+
+        iterator find(const key_type &k) { return _tree.find(k); };
+
+        const_iterator find(const key_type &k) const { return _tree.find(k); };
+
+        size_type count(const key_type &k) const { return _tree.count(k); };
+
+        iterator lower_bound(const key_type &k) { return _tree.lower_bound(k); };
+
+        const_iterator lower_bound(const key_type &k) const { return _tree.lower_bound(k); };
+
+        iterator upper_bound(const key_type &k) { return _tree.upper_bound(k); };
+
+        const_iterator upper_bound(const key_type &k) const { return _tree.upper_bound(k); };
+
+        ft::pair<iterator, iterator> equal_range(const key_type &k) { return _tree.equal_range(k); };
+
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const { return _tree.equal_range(k); };
+
+        const container_type &data() const { return _tree.data(); };
+    };
+
+    template <class Key, class T, class Compare, class Container>
+    bool operator==(const flat_map<Key, T, Compare, Container> &lhs, const flat_map<Key, T, Compare, Container> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class Key, class T, class Compare, class Container>
+    bool operator!=(const flat_map<Key, T, Compare, Container> &lhs, const flat_map<Key, T, Compare, Container> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Compare, class Container>
+    bool operator<(const flat_map<Key, T, Compare, Container> &lhs, const flat_map<Key, T, Compare, Container> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class Key, class T, class Compare, class Container>
+    bool operator<=(const flat_map<Key, T, Compare, Container> &lhs, const flat_map<Key, T, Compare, Container> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class Key, class T, class Compare, class Container>
+    bool operator>(const flat_map<Key, T, Compare, Container> &lhs, const flat_map<Key, T, Compare, Container> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class Key, class T, class Compare, class Container>
+    bool operator>=(const flat_map<Key, T, Compare, Container> &lhs, const flat_map<Key, T, Compare, Container> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class Key, class T, class Compare, class Container>
+    void swap(flat_map<Key, T, Compare, Container> &x, flat_map<Key, T, Compare, Container> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
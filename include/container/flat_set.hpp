@@ -0,0 +1,163 @@
+#ifndef FLAT_SET_HPP
+#define FLAT_SET_HPP
+
+#include <algorithm>
+#include <functional>
+
+#include "container/vector.hpp"
+
+#include "tree/flat_tree.hpp"
+
+#include "util/pair.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Set of unique keys kept sorted in a contiguous Container. Same
+     * interface as ft::set, but lookups binary-search dense memory and the
+     * only per-element overhead is the vector's spare capacity; inserting
+     * or erasing one element is O(n), so it suits read-mostly tables built
+     * with a bulk insert(first, last).
+     */
+    template <class T, class Compare = std::less<T>, class Container = ft::vector<T> >
+    class flat_set
+    {
+    public:
+        typedef T key_type;
+
+        typedef T value_type;
+
+        typedef Compare key_compare;
+
+        typedef Compare value_compare;
+
+        typedef Container container_type;
+
+        typedef typename Container::size_type size_type;
+
+        typedef typename Container::difference_type difference_type;
+
+    private:
+        typedef ft::flat_tree<value_type, Compare, ft::identity<value_type>, Container> tree_type;
+
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::const_iterator iterator;
+
+        typedef typename tree_type::const_iterator const_iterator;
+
+        typedef typename tree_type::const_reverse_iterator reverse_iterator;
+
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+        explicit flat_set(const key_compare &comp = key_compare()) : _tree(comp) {};
+
+        template <class InputIterator>
+        flat_set(InputIterator first, InputIterator last, const key_compare &comp = key_compare()) : _tree(comp)
+        {
+            _tree.insert_unique(first, last);
+        };
+
+        iterator begin() const { return _tree.begin(); };
+
+        iterator end() const { return _tree.end(); };
+
+        reverse_iterator rbegin() const { return _tree.rbegin(); };
+
+        reverse_iterator rend() const { return _tree.rend(); };
+
+        bool empty() const { return _tree.empty(); };
+
+        size_type size() const { return _tree.size(); };
+
+        size_type max_size() const { return _tree.max_size(); };
+
+        size_type capacity() const { return _tree.capacity(); };
+
+        void reserve(size_type n) { _tree.reserve(n); };
+
+        ft::pair<iterator, bool> insert(const value_type &val)
+        {
+            ft::pair<typename tree_type::iterator, bool> result = _tree.insert_unique(val);
+            return ft::pair<iterator, bool>(result.first, result.second);
+        };
+
+        iterator insert(iterator position, const value_type &val) { return _tree.insert_unique(position, val); };
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last) { _tree.insert_unique(first, last); };
+
+        iterator erase(iterator position) { return _tree.erase(position); };
+
+        size_type erase(const value_type &val) { return _tree.erase(val); };
+
+        iterator erase(iterator first, iterator last) { return _tree.erase(first, last); };
+
+        void swap(flat_set &x) { _tree.swap(x._tree); };
+
+        void clear() { _tree.clear(); };
+
+        key_compare key_comp() const { return _tree.get_comparator(); };
+
+        value_compare value_comp() const { return _tree.get_comparator(); };
+
+        iterator find(const value_type &k) const { return _tree.find(k); };
+
+        size_type count(const value_type &k) const { return _tree.count(k); };
+
+        iterator lower_bound(const value_type &k) const { return _tree.lower_bound(k); };
+
+        iterator upper_bound(const value_type &k) const { return _tree.upper_bound(k); };
+
+        ft::pair<iterator, iterator> equal_range(const value_type &k) const { return _tree.equal_range(k); };
+
+        const container_type &data() const { return _tree.data(); };
+    };
+
+    template <class T, class Compare, class Container>
+    bool operator==(const flat_set<T, Compare, Container> &lhs, const flat_set<T, Compare, Container> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T, class Compare, class Container>
+    bool operator!=(const flat_set<T, Compare, Container> &lhs, const flat_set<T, Compare, Container> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class Compare, class Container>
+    bool operator<(const flat_set<T, Compare, Container> &lhs, const flat_set<T, Compare, Container> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T, class Compare, class Container>
+    bool operator<=(const flat_set<T, Compare, Container> &lhs, const flat_set<T, Compare, Container> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, class Compare, class Container>
+    bool operator>(const flat_set<T, Compare, Container> &lhs, const flat_set<T, Compare, Container> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, class Compare, class Container>
+    bool operator>=(const flat_set<T, Compare, Container> &lhs, const flat_set<T, Compare, Container> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, class Compare, class Container>
+    void swap(flat_set<T, Compare, Container> &x, flat_set<T, Compare, Container> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
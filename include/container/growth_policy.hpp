@@ -0,0 +1,65 @@
+#ifndef GROWTH_POLICY_HPP
+#define GROWTH_POLICY_HPP
+
+#include <cstddef>
+
+namespace ft
+{
+
+    // Capacity growth policies for ft::vector. A policy is a type with a
+    // static next_capacity(capacity, required, element_size, max_size) that
+    // returns the new capacity, at least `required` and at most `max_size`
+    // (the caller guarantees required <= max_size).
+
+    /// Doubles the capacity (1, 2, 4, 8, ...): the fewest reallocations.
+    struct doubling_growth
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t, std::size_t max_size)
+        {
+            std::size_t grown = capacity == 0 ? 1 : (capacity > max_size / 2 ? max_size : capacity * 2);
+            return grown < required ? required : grown;
+        }
+    };
+
+    /// Grows by half the capacity: at most 50% unused memory, and freed
+    /// blocks can eventually be reused by later growth.
+    struct half_growth
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t, std::size_t max_size)
+        {
+            std::size_t grown = capacity == 0 ? 1 : (capacity > max_size - capacity / 2 ? max_size : capacity + capacity / 2);
+            return grown < required ? required : grown;
+        }
+    };
+
+    /**
+     * @brief Grows like @c Base, then rounds the block up so that the
+     * capacity covers what the allocator really hands out: malloc's 16-byte
+     * size classes for small buffers and whole pages for large ones, which
+     * malloc serves with mmap. The rounding counts malloc's chunk header
+     * (two words), plus the extra word an mmap'd chunk keeps, so the buffer
+     * never spills into the next class or page.
+     */
+    template <class Base = doubling_growth, std::size_t PageSize = 4096>
+    struct chunked_growth
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t element_size, std::size_t max_size)
+        {
+            const std::size_t grown = Base::next_capacity(capacity, required, element_size, max_size);
+            if (grown > (static_cast<std::size_t>(-1) - 2 * PageSize) / element_size)
+                return grown;
+
+            const std::size_t header = 2 * sizeof(std::size_t);
+            const std::size_t bytes = grown * element_size;
+            const bool paged = bytes + header >= PageSize;
+            const std::size_t granularity = paged ? PageSize : 16;
+            const std::size_t overhead = paged ? header + sizeof(std::size_t) : header;
+            const std::size_t block = (bytes + overhead + granularity - 1) / granularity * granularity;
+            const std::size_t fitted = (block - overhead) / element_size;
+            return fitted > max_size ? max_size : fitted;
+        }
+    };
+
+}
+
+#endif
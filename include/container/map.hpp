@@ -0,0 +1,418 @@
+#ifndef MAP_HPP
+#define MAP_HPP
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include "memory/pool_allocator.hpp"
+
+#include "tree/rb_tree.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/pair.hpp"
+
+namespace ft
+{
+
+    template <class Key, class T, class Compare = std::less<Key>, class Allocator = ft::pool_allocator<ft::pair<const Key, T> > >
+    class map
+    {
+    public:
+        typedef Key key_type;
+
+        typedef T mapped_type;
+
+        typedef ft::pair<const Key, T> value_type;
+
+        typedef Compare key_compare;
+
+        typedef Allocator allocator_type;
+
+        typedef typename allocator_type::reference reference;
+
+        typedef typename allocator_type::const_reference const_reference;
+
+        typedef typename allocator_type::pointer pointer;
+
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef typename allocator_type::difference_type difference_type;
+
+        typedef typename allocator_type::size_type size_type;
+
+        class value_compare
+        {
+            friend class map;
+
+        protected:
+            Compare comp;
+
+            value_compare(Compare c) : comp(c) {}
+
+        public:
+            typedef bool result_type;
+
+            typedef value_type first_argument_type;
+
+            typedef value_type second_argument_type;
+
+            bool operator()(const value_type &x, const value_type &y) const { return comp(x.first, y.first); }
+        };
+
+    private:
+        typedef ft::rb_tree<value_type, Compare, Allocator, ft::select_first<value_type> > tree_type;
+
+        // Builds the element operator[] inserts for a missing key.
+        struct default_value
+        {
+            value_type operator()(const key_type &k) const { return value_type(k, mapped_type()); }
+        };
+
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::iterator iterator;
+
+        typedef typename tree_type::const_iterator const_iterator;
+
+        typedef typename tree_type::reverse_iterator reverse_iterator;
+
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+        explicit map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc) {};
+
+        template <class InputIterator>
+        map(InputIterator first, InputIterator last, const key_compare &comp = key_compare(),
+            const allocator_type &alloc = allocator_type()) : _tree(comp, alloc)
+        {
+            _tree.insert_unique(first, last);
+        };
+
+        map(const map &x) : _tree(x._tree) {};
+
+        map &operator=(const map &x)
+        {
+            _tree = x._tree;
+            return *this;
+        };
+
+        ~map() {};
+
+        iterator begin() { return _tree.begin(); };
+
+        const_iterator begin() const { return _tree.begin(); };
+
+        iterator end() { return _tree.end(); };
+
+        const_iterator end() const { return _tree.end(); };
+
+        reverse_iterator rbegin() { return _tree.rbegin(); };
+
+        const_reverse_iterator rbegin() const { return _tree.rbegin(); };
+
+        reverse_iterator rend() { return _tree.rend(); };
+
+        const_reverse_iterator rend() const { return _tree.rend(); };
+
+        bool empty() const { return _tree.empty(); };
+
+        size_type size() const { return _tree.size(); };
+
+        size_type max_size() const { return _tree.max_size(); };
+
+        mapped_type &operator[](const key_type &k)
+        {
+            return _tree.find_or_insert(k, default_value()).first->second;
+        };
+
+        mapped_type &at(const key_type &k)
+        {
+            iterator it = _tree.find(k);
+            if (it == end())
+                throw std::out_of_range("map::at");
+            return it->second;
+        };
+
+        const mapped_type &at(const key_type &k) const
+        {
+            const_iterator it = _tree.find(k);
+            if (it == end())
+                throw std::out_of_range("map::at");
+            return it->second;
+        };
+
+        ft::pair<iterator, bool> insert(const value_type &val) { return _tree.insert_unique(val); };
+
+        iterator insert(iterator position, const value_type &val) { return _tree.insert_unique(position, val); };
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last) { _tree.insert_unique(first, last); };
+
+        void erase(iterator position) { _tree.erase(position); };
+
+        size_type erase(const key_type &k) { return _tree.erase(k); };
+
+        void erase(iterator first, iterator last) { _tree.erase(first, last); };
+
+        void swap(map &x) { _tree.swap(x._tree); };
+
+        void clear() { _tree.clear(); };
+
+        key_compare key_comp() const { return _tree.get_comparator(); };
+
+        value_compare value_comp() const { return value_compare(key_comp()); };
+
+        iterator find(const key_type &k) { return _tree.find(k); };
+
+        const_iterator find(const key_type &k) const { return _tree.find(k); };
+
+        size_type count(const key_type &k) const { return _tree.find(k) == _tree.end() ? 0 : 1; };
+
+        iterator lower_bound(const key_type &k) { return _tree.lower_bound(k); };
+
+        const_iterator lower_bound(const key_type &k) const { return _tree.lower_bound(k); };
+
+        iterator upper_bound(const key_type &k) { return _tree.upper_bound(k); };
+
+        const_iterator upper_bound(const key_type &k) const { return _tree.upper_bound(k); };
+
+        ft::pair<iterator, iterator> equal_range(const key_type &k) { return _tree.equal_range(k); };
+
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const { return _tree.equal_range(k); };
+
+        allocator_type get_allocator() const { return _tree.get_allocator(); };
+    };
+
+    template <class Key, class T, class Compare = std::less<Key>, class Allocator = ft::pool_allocator<ft::pair<const Key, T> > >
+    class multimap
+    {
+    public:
+        typedef Key key_type;
+
+        typedef T mapped_type;
+
+        typedef ft::pair<const Key, T> value_type;
+
+        typedef Compare key_compare;
+
+        typedef Allocator allocator_type;
+
+        typedef typename allocator_type::reference reference;
+
+        typedef typename allocator_type::const_reference const_reference;
+
+        typedef typename allocator_type::pointer pointer;
+
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef typename allocator_type::difference_type difference_type;
+
+        typedef typename allocator_type::size_type size_type;
+
+        class value_compare
+        {
+            friend class multimap;
+
+        protected:
+            Compare comp;
+
+            value_compare(Compare c) : comp(c) {}
+
+        public:
+            typedef bool result_type;
+
+            typedef value_type first_argument_type;
+
+            typedef value_type second_argument_type;
+
+            bool operator()(const value_type &x, const value_type &y) const { return comp(x.first, y.first); }
+        };
+
+    private:
+        typedef ft::rb_tree<value_type, Compare, Allocator, ft::select_first<value_type> > tree_type;
+
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::iterator iterator;
+
+        typedef typename tree_type::const_iterator const_iterator;
+
+        typedef typename tree_type::reverse_iterator reverse_iterator;
+
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+        explicit multimap(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc) {};
+
+        template <class InputIterator>
+        multimap(InputIterator first, InputIterator last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type()) : _tree(comp, alloc)
+        {
+            _tree.insert_equal(first, last);
+        };
+
+        multimap(const multimap &x) : _tree(x._tree) {};
+
+        multimap &operator=(const multimap &x)
+        {
+            _tree = x._tree;
+            return *this;
+        };
+
+        ~multimap() {};
+
+        iterator begin() { return _tree.begin(); };
+
+        const_iterator begin() const { return _tree.begin(); };
+
+        iterator end() { return _tree.end(); };
+
+        const_iterator end() const { return _tree.end(); };
+
+        reverse_iterator rbegin() { return _tree.rbegin(); };
+
+        const_reverse_iterator rbegin() const { return _tree.rbegin(); };
+
+        reverse_iterator rend() { return _tree.rend(); };
+
+        const_reverse_iterator rend() const { return _tree.rend(); };
+
+        bool empty() const { return _tree.empty(); };
+
+        size_type size() const { return _tree.size(); };
+
+        size_type max_size() const { return _tree.max_size(); };
+
+        iterator insert(const value_type &val) { return _tree.insert_equal(val); };
+
+        iterator insert(iterator position, const value_type &val) { return _tree.insert_equal(position, val); };
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last) { _tree.insert_equal(first, last); };
+
+        void erase(iterator position) { _tree.erase(position); };
+
+        size_type erase(const key_type &k) { return _tree.erase(k); };
+
+        void erase(iterator first, iterator last) { _tree.erase(first, last); };
+
+        void swap(multimap &x) { _tree.swap(x._tree); };
+
+        void clear() { _tree.clear(); };
+
+        key_compare key_comp() const { return _tree.get_comparator(); };
+
+        value_compare value_comp() const { return value_compare(key_comp()); };
+
+        iterator find(const key_type &k) { return _tree.find(k); };
+
+        const_iterator find(const key_type &k) const { return _tree.find(k); };
+
+        size_type count(const key_type &k) const { return _tree.count(k); };
+
+        iterator lower_bound(const key_type &k) { return _tree.lower_bound(k); };
+
+        const_iterator lower_bound(const key_type &k) const { return _tree.lower_bound(k); };
+
+        iterator upper_bound(const key_type &k) { return _tree.upper_bound(k); };
+
+        const_iterator upper_bound(const key_type &k) const { return _tree.upper_bound(k); };
+
+        ft::pair<iterator, iterator> equal_range(const key_type &k) { return _tree.equal_range(k); };
+
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const { return _tree.equal_range(k); };
+
+        allocator_type get_allocator() const { return _tree.get_allocator(); };
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator==(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator!=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator<(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator<=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator>(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator>=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    void swap(map<Key, T, Compare, Alloc> &x, map<Key, T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator==(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator!=(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator<(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator<=(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator>(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator>=(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    void swap(multimap<Key, T, Compare, Alloc> &x, multimap<Key, T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
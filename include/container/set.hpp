@@ -0,0 +1,318 @@
+#ifndef SET_HPP
+#define SET_HPP
+
+#include <algorithm>
+#include <functional>
+
+#include "memory/pool_allocator.hpp"
+
+#include "tree/rb_tree.hpp"
+
+#include "util/pair.hpp"
+
+namespace ft
+{
+
+    template <class T, class Compare = std::less<T>, class Allocator = ft::pool_allocator<T> >
+    class set
+    {
+    public:
+        typedef T key_type;
+
+        typedef T value_type;
+
+        typedef Compare key_compare;
+
+        typedef Compare value_compare;
+
+        typedef Allocator allocator_type;
+
+        typedef typename allocator_type::reference reference;
+
+        typedef typename allocator_type::const_reference const_reference;
+
+        typedef typename allocator_type::pointer pointer;
+
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef typename allocator_type::difference_type difference_type;
+
+        typedef typename allocator_type::size_type size_type;
+
+    private:
+        typedef ft::rb_tree<value_type, Compare, Allocator> tree_type;
+
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::const_iterator iterator;
+
+        typedef typename tree_type::const_iterator const_iterator;
+
+        typedef typename tree_type::const_reverse_iterator reverse_iterator;
+
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+        explicit set(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc) {};
+
+        template <class InputIterator>
+        set(InputIterator first, InputIterator last, const key_compare &comp = key_compare(),
+            const allocator_type &alloc = allocator_type()) : _tree(comp, alloc)
+        {
+            _tree.insert_unique(first, last);
+        };
+
+        set(const set &x) : _tree(x._tree) {};
+
+        set &operator=(const set &x)
+        {
+            _tree = x._tree;
+            return *this;
+        };
+
+        ~set() {};
+
+        iterator begin() const { return _tree.begin(); };
+
+        iterator end() const { return _tree.end(); };
+
+        reverse_iterator rbegin() const { return _tree.rbegin(); };
+
+        reverse_iterator rend() const { return _tree.rend(); };
+
+        bool empty() const { return _tree.empty(); };
+
+        size_type size() const { return _tree.size(); };
+
+        size_type max_size() const { return _tree.max_size(); };
+
+        ft::pair<iterator, bool> insert(const value_type &val) { return _tree.insert_unique(val); };
+
+        iterator insert(iterator position, const value_type &val) { return _tree.insert_unique(position, val); };
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last) { _tree.insert_unique(first, last); };
+
+        void erase(iterator position) { _tree.erase(position); };
+
+        size_type erase(const value_type &val) { return _tree.erase(val); };
+
+        void erase(iterator first, iterator last) { _tree.erase(first, last); };
+
+        void swap(set &x) { _tree.swap(x._tree); };
+
+        void clear() { _tree.clear(); };
+
+        key_compare key_comp() const { return _tree.get_comparator(); };
+
+        value_compare value_comp() const { return _tree.get_comparator(); };
+
+        iterator find(const value_type &k) const { return _tree.find(k); };
+
+        size_type count(const value_type &k) const { return _tree.find(k) == _tree.end() ? 0 : 1; };
+
+        iterator lower_bound(const value_type &k) const { return _tree.lower_bound(k); };
+
+        iterator upper_bound(const value_type &k) const { return _tree.upper_bound(k); };
+
+        ft::pair<iterator, iterator> equal_range(const value_type &k) const { return _tree.equal_range(k); };
+
+        allocator_type get_allocator() const { return _tree.get_allocator(); };
+    };
+
+    template <class T, class Compare = std::less<T>, class Allocator = ft::pool_allocator<T> >
+    class multiset
+    {
+    public:
+        typedef T key_type;
+
+        typedef T value_type;
+
+        typedef Compare key_compare;
+
+        typedef Compare value_compare;
+
+        typedef Allocator allocator_type;
+
+        typedef typename allocator_type::reference reference;
+
+        typedef typename allocator_type::const_reference const_reference;
+
+        typedef typename allocator_type::pointer pointer;
+
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef typename allocator_type::difference_type difference_type;
+
+        typedef typename allocator_type::size_type size_type;
+
+    private:
+        typedef ft::rb_tree<value_type, Compare, Allocator> tree_type;
+
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::const_iterator iterator;
+
+        typedef typename tree_type::const_iterator const_iterator;
+
+        typedef typename tree_type::const_reverse_iterator reverse_iterator;
+
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+        explicit multiset(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc) {};
+
+        template <class InputIterator>
+        multiset(InputIterator first, InputIterator last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type()) : _tree(comp, alloc)
+        {
+            _tree.insert_equal(first, last);
+        };
+
+        multiset(const multiset &x) : _tree(x._tree) {};
+
+        multiset &operator=(const multiset &x)
+        {
+            _tree = x._tree;
+            return *this;
+        };
+
+        ~multiset() {};
+
+        iterator begin() const { return _tree.begin(); };
+
+        iterator end() const { return _tree.end(); };
+
+        reverse_iterator rbegin() const { return _tree.rbegin(); };
+
+        reverse_iterator rend() const { return _tree.rend(); };
+
+        bool empty() const { return _tree.empty(); };
+
+        size_type size() const { return _tree.size(); };
+
+        size_type max_size() const { return _tree.max_size(); };
+
+        iterator insert(const value_type &val) { return _tree.insert_equal(val); };
+
+        iterator insert(iterator position, const value_type &val) { return _tree.insert_equal(position, val); };
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last) { _tree.insert_equal(first, last); };
+
+        void erase(iterator position) { _tree.erase(position); };
+
+        size_type erase(const value_type &val) { return _tree.erase(val); };
+
+        void erase(iterator first, iterator last) { _tree.erase(first, last); };
+
+        void swap(multiset &x) { _tree.swap(x._tree); };
+
+        void clear() { _tree.clear(); };
+
+        key_compare key_comp() const { return _tree.get_comparator(); };
+
+        value_compare value_comp() const { return _tree.get_comparator(); };
+
+        iterator find(const value_type &k) const { return _tree.find(k); };
+
+        size_type count(const value_type &k) const { return _tree.count(k); };
+
+        iterator lower_bound(const value_type &k) const { return _tree.lower_bound(k); };
+
+        iterator upper_bound(const value_type &k) const { return _tree.upper_bound(k); };
+
+        ft::pair<iterator, iterator> equal_range(const value_type &k) const { return _tree.equal_range(k); };
+
+        allocator_type get_allocator() const { return _tree.get_allocator(); };
+    };
+
+    template <class T, class Compare, class Alloc>
+    bool operator==(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator!=(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator<(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator<=(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator>(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator>=(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    void swap(set<T, Compare, Alloc> &x, set<T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator==(const multiset<T, Compare, Alloc> &lhs, const multiset<T, Compare, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator!=(const multiset<T, Compare, Alloc> &lhs, const multiset<T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator<(const multiset<T, Compare, Alloc> &lhs, const multiset<T, Compare, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator<=(const multiset<T, Compare, Alloc> &lhs, const multiset<T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator>(const multiset<T, Compare, Alloc> &lhs, const multiset<T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, class Compare, class Alloc>
+    bool operator>=(const multiset<T, Compare, Alloc> &lhs, const multiset<T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    void swap(multiset<T, Compare, Alloc> &x, multiset<T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
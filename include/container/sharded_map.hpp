@@ -0,0 +1,369 @@
+#ifndef SHARDED_MAP_HPP
+#define SHARDED_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <pthread.h>
+
+#include "container/vector.hpp"
+
+#include "tree/rb_tree.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/hash.hpp"
+
+#include "util/pair.hpp"
+
+namespace ft
+{
+
+    /// Spreads keys over @c shards shards by hash: even load for point
+    /// operations, whatever the key distribution.
+    template <class Key, class Hash = ft::hash<Key> >
+    class hash_partition
+    {
+    public:
+        explicit hash_partition(std::size_t shards = 16, const Hash &hash = Hash())
+            : _shards(shards == 0 ? 1 : shards), _hash(hash) {}
+
+        std::size_t shard_count() const { return _shards; }
+
+        std::size_t operator()(const Key &k) const { return _hash(k) % _shards; }
+
+    private:
+        std::size_t _shards;
+        Hash _hash;
+    };
+
+    /**
+     * @brief Splits the key space at sorted split points: shard i holds the
+     * keys in [split[i - 1], split[i]), so neighbouring keys share a shard
+     * and an ordered scan visits the shards one after the other.
+     */
+    template <class Key, class Compare = std::less<Key> >
+    class range_partition
+    {
+    public:
+        range_partition() : _splits(), _compare() {}
+
+        template <class InputIterator>
+        range_partition(InputIterator first, InputIterator last, const Compare &compare = Compare())
+            : _splits(first, last), _compare(compare) {}
+
+        std::size_t shard_count() const { return _splits.size() + 1; }
+
+        std::size_t operator()(const Key &k) const
+        {
+            return std::upper_bound(_splits.begin(), _splits.end(), k, _compare) - _splits.begin();
+        }
+
+    private:
+        ft::vector<Key> _splits;
+        Compare _compare;
+    };
+
+    /**
+     * @brief Ordered map for concurrent use, partitioned by @c Partition
+     * into rb_tree shards that each have their own reader-writer lock.
+     * Threads working on different shards never contend, and lookups in the
+     * same shard share its lock.
+     *
+     * Element access copies values in and out under the shard's lock, since
+     * a reference could be invalidated by another thread as soon as the lock
+     * is dropped. An ordered_view read-locks every shard and walks them
+     * merged in key order. Each shard default-constructs its own allocator,
+     * so the default pool allocator stays private to its shard's lock.
+     */
+    template <class Key, class T, class Compare = std::less<Key>, class Partition = ft::hash_partition<Key>,
+              class Allocator = ft::pool_allocator<ft::pair<const Key, T> > >
+    class sharded_map
+    {
+    public:
+        typedef Key key_type;
+
+        typedef T mapped_type;
+
+        typedef ft::pair<const Key, T> value_type;
+
+        typedef Compare key_compare;
+
+        typedef Partition partition_type;
+
+        typedef Allocator allocator_type;
+
+        typedef std::size_t size_type;
+
+    private:
+        typedef ft::rb_tree<value_type, Compare, Allocator, ft::select_first<value_type> > tree_type;
+
+        // The trailing padding keeps a shard's lock and tree header off the
+        // cache lines of the next shard's.
+        struct shard
+        {
+            pthread_rwlock_t lock;
+            tree_type tree;
+            char padding[64];
+
+            explicit shard(const Compare &compare) : tree(compare) { pthread_rwlock_init(&lock, NULL); }
+
+            ~shard() { pthread_rwlock_destroy(&lock); }
+        };
+
+        class read_guard
+        {
+        public:
+            explicit read_guard(shard &s) : _lock(s.lock) { pthread_rwlock_rdlock(&_lock); }
+
+            ~read_guard() { pthread_rwlock_unlock(&_lock); }
+
+        private:
+            pthread_rwlock_t &_lock;
+        };
+
+        class write_guard
+        {
+        public:
+            explicit write_guard(shard &s) : _lock(s.lock) { pthread_rwlock_wrlock(&_lock); }
+
+            ~write_guard() { pthread_rwlock_unlock(&_lock); }
+
+        private:
+            pthread_rwlock_t &_lock;
+        };
+
+        ft::vector<shard *> _shards;
+        Partition _partition;
+        Compare _compare;
+
+        sharded_map(const sharded_map &);
+
+        sharded_map &operator=(const sharded_map &);
+
+    public:
+        explicit sharded_map(const Partition &partition = Partition(), const Compare &compare = Compare())
+            : _shards(), _partition(partition), _compare(compare)
+        {
+            _shards.reserve(partition.shard_count());
+            try
+            {
+                for (size_type index = 0; index < partition.shard_count(); ++index)
+                    _shards.push_back(new shard(compare));
+            }
+            catch (...)
+            {
+                release();
+                throw;
+            }
+        }
+
+        // Must not race with other operations.
+        ~sharded_map() { release(); }
+
+        size_type shard_count() const { return _shards.size(); }
+
+        /// Inserts @c value unless its key is present; returns whether it did.
+        bool insert(const value_type &value)
+        {
+            shard &s = shard_of(value.first);
+            write_guard guard(s);
+            return s.tree.insert_unique(value).second;
+        }
+
+        /// Inserts or overwrites; returns true when the key was new.
+        bool assign(const key_type &k, const mapped_type &value)
+        {
+            shard &s = shard_of(k);
+            write_guard guard(s);
+            ft::pair<typename tree_type::iterator, bool> result = s.tree.insert_unique(value_type(k, value));
+            if (!result.second)
+                result.first->second = value;
+            return result.second;
+        }
+
+        size_type erase(const key_type &k)
+        {
+            shard &s = shard_of(k);
+            write_guard guard(s);
+            return s.tree.erase(k);
+        }
+
+        /// Copies the value mapped to @c k into @c out; false when absent.
+        bool find(const key_type &k, mapped_type &out) const
+        {
+            shard &s = shard_of(k);
+            read_guard guard(s);
+            typename tree_type::const_iterator it = s.tree.find(k);
+            if (it == s.tree.end())
+                return false;
+            out = it->second;
+            return true;
+        }
+
+        size_type count(const key_type &k) const
+        {
+            shard &s = shard_of(k);
+            read_guard guard(s);
+            return s.tree.count(k);
+        }
+
+        /// Sum of the shard sizes, each read under its own lock: exact only
+        /// while no writer is active.
+        size_type size() const
+        {
+            size_type total = 0;
+            for (size_type index = 0; index < _shards.size(); ++index)
+            {
+                read_guard guard(*_shards[index]);
+                total += _shards[index]->tree.size();
+            }
+            return total;
+        }
+
+        bool empty() const { return size() == 0; }
+
+        void clear()
+        {
+            for (size_type index = 0; index < _shards.size(); ++index)
+            {
+                write_guard guard(*_shards[index]);
+                _shards[index]->tree = tree_type(_compare);
+            }
+        }
+
+        key_compare key_comp() const { return _compare; }
+
+        /**
+         * @brief Consistent ordered traversal: read-locks every shard (in
+         * shard order) for its lifetime and merges them by key. Writers
+         * block until it is destroyed; do not modify the map from the
+         * thread holding it.
+         */
+        class ordered_view
+        {
+        private:
+            typedef typename tree_type::const_iterator tree_iterator;
+            typedef ft::pair<tree_iterator, tree_iterator> cursor;
+
+            // Heap order: the cursor with the smallest key on top.
+            class cursor_greater
+            {
+            public:
+                explicit cursor_greater(const Compare &compare) : _compare(compare) {}
+
+                bool operator()(const cursor &a, const cursor &b) const { return _compare(b.first->first, a.first->first); }
+
+            private:
+                Compare _compare;
+            };
+
+        public:
+            class const_iterator
+            {
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef typename sharded_map::value_type value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const value_type *pointer;
+                typedef const value_type &reference;
+
+                const_iterator() : _heap(), _greater(Compare()) {}
+
+                reference operator*() const { return *_heap.front().first; }
+
+                pointer operator->() const { return &*_heap.front().first; }
+
+                const_iterator &operator++()
+                {
+                    std::pop_heap(_heap.begin(), _heap.end(), _greater);
+                    cursor &next = _heap.back();
+                    if (++next.first == next.second)
+                        _heap.pop_back();
+                    else
+                        std::push_heap(_heap.begin(), _heap.end(), _greater);
+                    return *this;
+                }
+
+                const_iterator operator++(int)
+                {
+                    const_iterator tmp(*this);
+                    ++*this;
+                    return tmp;
+                }
+
+                bool operator==(const const_iterator &other) const
+                {
+                    return _heap.empty() ? other._heap.empty() : !other._heap.empty() && _heap.front().first == other._heap.front().first;
+                }
+
+                bool operator!=(const const_iterator &other) const { return !(*this == other); }
+
+            private:
+                friend class ordered_view;
+
+                ft::vector<cursor> _heap;
+                cursor_greater _greater;
+            };
+
+            explicit ordered_view(const sharded_map &map) : _map(map)
+            {
+                for (size_type index = 0; index < _map._shards.size(); ++index)
+                    pthread_rwlock_rdlock(&_map._shards[index]->lock);
+            }
+
+            ~ordered_view()
+            {
+                for (size_type index = _map._shards.size(); index != 0; --index)
+                    pthread_rwlock_unlock(&_map._shards[index - 1]->lock);
+            }
+
+            size_type size() const
+            {
+                size_type total = 0;
+                for (size_type index = 0; index < _map._shards.size(); ++index)
+                    total += _map._shards[index]->tree.size();
+                return total;
+            }
+
+            const_iterator begin() const
+            {
+                const_iterator it;
+                it._greater = cursor_greater(_map._compare);
+                for (size_type index = 0; index < _map._shards.size(); ++index)
+                {
+                    const tree_type &tree = _map._shards[index]->tree;
+                    if (!tree.empty())
+                        it._heap.push_back(cursor(tree.begin(), tree.end()));
+                }
+                std::make_heap(it._heap.begin(), it._heap.end(), it._greater);
+                return it;
+            }
+
+            const_iterator end() const { return const_iterator(); }
+
+        private:
+            ordered_view(const ordered_view &);
+
+            ordered_view &operator=(const ordered_view &);
+
+            const sharded_map &_map;
+        };
+
+    private:
+        shard &shard_of(const key_type &k) const
+        {
+            return *_shards[_partition(k)];
+        }
+
+        void release()
+        {
+            for (size_type index = 0; index < _shards.size(); ++index)
+                delete _shards[index];
+            _shards.clear();
+        }
+    };
+
+}
+
+#endif
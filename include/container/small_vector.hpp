@@ -0,0 +1,234 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <memory>
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+#include "util/compare.hpp"
+
+#include "container/vector_base.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief ft::vector with room for N elements inside the object itself.
+     *
+     * Up to N elements live in the inline buffer and never touch the
+     * allocator; the first insertion beyond N moves them to a heap block
+     * sized by GrowthPolicy (2N with the default), after which it behaves
+     * like ft::vector. The interface and the iterator type are the same as
+     * ft::vector's, so code written against vector iterators works on both.
+     *
+     * Swapping or moving an inline small_vector relocates its elements, so
+     * unlike ft::vector those operations invalidate iterators while the
+     * elements are inline.
+     */
+    template <class T, std::size_t N, class Allocator = std::allocator<T>, class GrowthPolicy = ft::doubling_growth>
+    class small_vector : public ft::vector_base<small_vector<T, N, Allocator, GrowthPolicy>, T, Allocator, GrowthPolicy>
+    {
+        typedef ft::vector_base<small_vector, T, Allocator, GrowthPolicy> base_type;
+
+        friend class ft::vector_base<small_vector, T, Allocator, GrowthPolicy>;
+
+        using base_type::_alloc;
+        using base_type::_start;
+        using base_type::_finish;
+        using base_type::_end_of_storage;
+
+    public:
+        typedef typename base_type::value_type value_type;
+
+        typedef typename base_type::allocator_type allocator_type;
+
+        typedef typename base_type::const_reference const_reference;
+
+        typedef typename base_type::pointer pointer;
+
+        typedef typename base_type::const_pointer const_pointer;
+
+        typedef typename base_type::size_type size_type;
+
+        static const size_type inline_capacity = N;
+
+        explicit small_vector(allocator_type const &alloc = allocator_type()) : base_type(alloc)
+        {
+            reset_inline();
+        };
+
+        explicit small_vector(size_type n, const_reference val = value_type(), allocator_type const &alloc = allocator_type()) :
+            base_type(alloc)
+        {
+            reset_inline();
+            this->assign(n, val);
+        };
+
+        template <class InputIterator>
+        small_vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
+                     typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL) :
+            base_type(alloc)
+        {
+            reset_inline();
+            this->assign(first, last);
+        };
+
+        small_vector(const small_vector &x) : base_type(x._alloc)
+        {
+            reset_inline();
+            this->assign(x._start, x._finish);
+        };
+
+        small_vector &operator=(small_vector const &other)
+        {
+            if (this != &other)
+                this->assign(other._start, other._finish);
+            return *this;
+        };
+
+#if __cplusplus >= 201103L
+        small_vector(small_vector &&x) noexcept : base_type(x._alloc)
+        {
+            reset_inline();
+            take(x);
+        };
+
+        small_vector &operator=(small_vector &&other) noexcept
+        {
+            if (this == &other)
+                return *this;
+            this->clear();
+            release(_start, this->capacity());
+            reset_inline();
+            take(other);
+            return *this;
+        };
+#endif
+
+        ~small_vector()
+        {
+            ft::destroy(_start, _finish);
+            release(_start, this->capacity());
+        };
+
+        /// Whether the elements are still in the inline buffer.
+        bool is_inline() const { return _start == inline_data(); };
+
+        // Heap blocks are exchanged; inline elements are relocated through
+        // a temporary.
+        void swap(small_vector &other)
+        {
+            if (this == &other)
+                return;
+            if (!is_inline() && !other.is_inline())
+            {
+                std::swap(_alloc, other._alloc);
+                std::swap(_start, other._start);
+                std::swap(_finish, other._finish);
+                std::swap(_end_of_storage, other._end_of_storage);
+                return;
+            }
+            small_vector tmp(_alloc);
+            tmp.take(*this);
+            reset_inline();
+            std::swap(_alloc, other._alloc);
+            take(other);
+            other.take(tmp);
+        };
+
+    private:
+        // Storage for N elements, aligned for any fundamental type since
+        // T itself may not appear in a C++98 union.
+        union inline_buffer
+        {
+            char bytes[(N == 0 ? 1 : N) * sizeof(T)];
+            long double long_double_alignment;
+            long long long_long_alignment;
+            void *pointer_alignment;
+        };
+
+        pointer inline_data() { return reinterpret_cast<pointer>(_buffer.bytes); }
+
+        const_pointer inline_data() const { return reinterpret_cast<const_pointer>(_buffer.bytes); }
+
+        void reset_inline()
+        {
+            _start = inline_data();
+            _finish = _start;
+            _end_of_storage = _start + N;
+        }
+
+        // The inline buffer is never handed to the allocator.
+        void release(pointer start, size_type capacity)
+        {
+            if (start != inline_data())
+                _alloc.deallocate(start, capacity);
+        }
+
+        // Takes other's elements, leaving it empty; *this must be empty and
+        // inline. A heap block is stolen, inline elements are relocated.
+        void take(small_vector &other)
+        {
+            if (!other.is_inline())
+            {
+                _start = other._start;
+                _finish = other._finish;
+                _end_of_storage = other._end_of_storage;
+            }
+            else
+                _finish = ft::relocate(other._start, other._finish, _start);
+            other.reset_inline();
+        }
+
+        inline_buffer _buffer;
+    };
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    const typename small_vector<T, N, Alloc, Growth>::size_type small_vector<T, N, Alloc, Growth>::inline_capacity;
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    bool operator==(const small_vector<T, N, Alloc, Growth> &lhs, const small_vector<T, N, Alloc, Growth> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::contiguous_equal(lhs.begin().base(), rhs.begin().base(), lhs.size());
+    }
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    bool operator!=(const small_vector<T, N, Alloc, Growth> &lhs, const small_vector<T, N, Alloc, Growth> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    bool operator<(const small_vector<T, N, Alloc, Growth> &lhs, const small_vector<T, N, Alloc, Growth> &rhs)
+    {
+        return ft::contiguous_less(lhs.begin().base(), lhs.size(), rhs.begin().base(), rhs.size());
+    }
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    bool operator<=(const small_vector<T, N, Alloc, Growth> &lhs, const small_vector<T, N, Alloc, Growth> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    bool operator>(const small_vector<T, N, Alloc, Growth> &lhs, const small_vector<T, N, Alloc, Growth> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    bool operator>=(const small_vector<T, N, Alloc, Growth> &lhs, const small_vector<T, N, Alloc, Growth> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    void swap(small_vector<T, N, Alloc, Growth> &x, small_vector<T, N, Alloc, Growth> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
@@ -0,0 +1,209 @@
+#ifndef UNORDERED_MAP_HPP
+#define UNORDERED_MAP_HPP
+
+#include <functional>
+#include <stdexcept>
+
+#include "memory/allocator.hpp"
+
+#include "tree/hash_table.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/hash.hpp"
+
+#include "util/pair.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Map with unique keys and no ordering, stored in an open-addressing
+     * ft::hash_table. Unlike std::unordered_map, any insertion may move the
+     * elements and invalidate references to them; erasing never does.
+     * find, count and erase accept other key types when both Hash and
+     * KeyEqual are transparent (e.g. ft::hash<std::string> with
+     * ft::equal_to<>).
+     */
+    template <class Key, class T, class Hash = ft::hash<Key>, class KeyEqual = std::equal_to<Key>,
+              class Allocator = ft::allocator<ft::pair<const Key, T> > >
+    class unordered_map
+    {
+    public:
+        typedef Key key_type;
+
+        typedef T mapped_type;
+
+        typedef ft::pair<const Key, T> value_type;
+
+        typedef Hash hasher;
+
+        typedef KeyEqual key_equal;
+
+        typedef Allocator allocator_type;
+
+        typedef typename allocator_type::reference reference;
+
+        typedef typename allocator_type::const_reference const_reference;
+
+        typedef typename allocator_type::pointer pointer;
+
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef typename allocator_type::difference_type difference_type;
+
+        typedef typename allocator_type::size_type size_type;
+
+    private:
+        typedef ft::hash_table<value_type, Hash, KeyEqual, Allocator, ft::select_first<value_type> > table_type;
+
+        table_type _table;
+
+    public:
+        typedef typename table_type::iterator iterator;
+
+        typedef typename table_type::const_iterator const_iterator;
+
+        explicit unordered_map(size_type n = 0, const hasher &hf = hasher(), const key_equal &eql = key_equal(),
+                               const allocator_type &alloc = allocator_type())
+            : _table(n, hf, eql, alloc) {};
+
+        template <class InputIterator>
+        unordered_map(InputIterator first, InputIterator last, size_type n = 0, const hasher &hf = hasher(),
+                      const key_equal &eql = key_equal(), const allocator_type &alloc = allocator_type())
+            : _table(n, hf, eql, alloc)
+        {
+            _table.insert_unique(first, last);
+        };
+
+        iterator begin() { return _table.begin(); };
+
+        const_iterator begin() const { return _table.begin(); };
+
+        iterator end() { return _table.end(); };
+
+        const_iterator end() const { return _table.end(); };
+
+        bool empty() const { return _table.empty(); };
+
+        size_type size() const { return _table.size(); };
+
+        size_type max_size() const { return _table.max_size(); };
+
+        mapped_type &operator[](const key_type &k)
+        {
+            iterator it = _table.find(k);
+            if (it == end())
+                it = _table.insert_unique(value_type(k, mapped_type())).first;
+            return it->second;
+        };
+
+        mapped_type &at(const key_type &k)
+        {
+            iterator it = _table.find(k);
+            if (it == end())
+                throw std::out_of_range("unordered_map::at");
+            return it->second;
+        };
+
+        const mapped_type &at(const key_type &k) const
+        {
+            const_iterator it = _table.find(k);
+            if (it == end())
+                throw std::out_of_range("unordered_map::at");
+            return it->second;
+        };
+
+        ft::pair<iterator, bool> insert(const value_type &val) { return _table.insert_unique(val); };
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last) { _table.insert_unique(first, last); };
+
+        iterator erase(const_iterator position) { return _table.erase(position); };
+
+        iterator erase(iterator position) { return _table.erase(position); };
+
+        size_type erase(const key_type &k) { return _table.erase(k); };
+
+        template <class K>
+        typename table_type::template if_transparent<K, size_type>::type erase(const K &k) { return _table.erase(k); };
+
+        iterator erase(const_iterator first, const_iterator last) { return _table.erase(first, last); };
+
+        void clear() { _table.clear(); };
+
+        void swap(unordered_map &x) { _table.swap(x._table); };
+
+        iterator find(const key_type &k) { return _table.find(k); };
+
+        const_iterator find(const key_type &k) const { return _table.find(k); };
+
+        template <class K>
+        typename table_type::template if_transparent<K, iterator>::type find(const K &k) { return _table.find(k); };
+
+        template <class K>
+        typename table_type::template if_transparent<K, const_iterator>::type find(const K &k) const { return _table.find(k); };
+
+        size_type count(const key_type &k) const { return _table.count(k); };
+
+        template <class K>
+        typename table_type::template if_transparent<K, size_type>::type count(const K &k) const { return _table.count(k); };
+
+        ft::pair<iterator, iterator> equal_range(const key_type &k)
+        {
+            iterator it = _table.find(k);
+            return ft::make_pair(it, it == end() ? it : ++iterator(it));
+        };
+
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+        {
+            const_iterator it = _table.find(k);
+            return ft::make_pair(it, it == end() ? it : ++const_iterator(it));
+        };
+
+        size_type bucket_count() const { return _table.bucket_count(); };
+
+        float load_factor() const { return _table.load_factor(); };
+
+        float max_load_factor() const { return _table.max_load_factor(); };
+
+        void rehash(size_type n) { _table.rehash(n); };
+
+        void reserve(size_type n) { _table.reserve(n); };
+
+        hasher hash_function() const { return _table.hash_function(); };
+
+        key_equal key_eq() const { return _table.key_eq(); };
+
+        allocator_type get_allocator() const { return _table.get_allocator(); };
+    };
+
+    template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+    bool operator==(const unordered_map<Key, T, Hash, KeyEqual, Alloc> &lhs, const unordered_map<Key, T, Hash, KeyEqual, Alloc> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+        {
+            typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator other = rhs.find(it->first);
+            if (other == rhs.end() || !(other->second == it->second))
+                return false;
+        }
+        return true;
+    }
+
+    template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+    bool operator!=(const unordered_map<Key, T, Hash, KeyEqual, Alloc> &lhs, const unordered_map<Key, T, Hash, KeyEqual, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+    void swap(unordered_map<Key, T, Hash, KeyEqual, Alloc> &x, unordered_map<Key, T, Hash, KeyEqual, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
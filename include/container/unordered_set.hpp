@@ -0,0 +1,162 @@
+#ifndef UNORDERED_SET_HPP
+#define UNORDERED_SET_HPP
+
+#include <functional>
+
+#include "memory/allocator.hpp"
+
+#include "tree/hash_table.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/hash.hpp"
+
+#include "util/pair.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Set with unique keys and no ordering; see ft::unordered_map for
+     * iterator invalidation and heterogeneous lookup.
+     */
+    template <class Key, class Hash = ft::hash<Key>, class KeyEqual = std::equal_to<Key>,
+              class Allocator = ft::allocator<Key> >
+    class unordered_set
+    {
+    public:
+        typedef Key key_type;
+
+        typedef Key value_type;
+
+        typedef Hash hasher;
+
+        typedef KeyEqual key_equal;
+
+        typedef Allocator allocator_type;
+
+        typedef typename allocator_type::reference reference;
+
+        typedef typename allocator_type::const_reference const_reference;
+
+        typedef typename allocator_type::pointer pointer;
+
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef typename allocator_type::difference_type difference_type;
+
+        typedef typename allocator_type::size_type size_type;
+
+    private:
+        typedef ft::hash_table<value_type, Hash, KeyEqual, Allocator> table_type;
+
+        table_type _table;
+
+    public:
+        typedef typename table_type::const_iterator iterator;
+
+        typedef typename table_type::const_iterator const_iterator;
+
+        explicit unordered_set(size_type n = 0, const hasher &hf = hasher(), const key_equal &eql = key_equal(),
+                               const allocator_type &alloc = allocator_type())
+            : _table(n, hf, eql, alloc) {};
+
+        template <class InputIterator>
+        unordered_set(InputIterator first, InputIterator last, size_type n = 0, const hasher &hf = hasher(),
+                      const key_equal &eql = key_equal(), const allocator_type &alloc = allocator_type())
+            : _table(n, hf, eql, alloc)
+        {
+            _table.insert_unique(first, last);
+        };
+
+        iterator begin() const { return _table.begin(); };
+
+        iterator end() const { return _table.end(); };
+
+        bool empty() const { return _table.empty(); };
+
+        size_type size() const { return _table.size(); };
+
+        size_type max_size() const { return _table.max_size(); };
+
+        ft::pair<iterator, bool> insert(const value_type &val)
+        {
+            ft::pair<typename table_type::iterator, bool> result = _table.insert_unique(val);
+            return ft::pair<iterator, bool>(result.first, result.second);
+        };
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last) { _table.insert_unique(first, last); };
+
+        iterator erase(const_iterator position) { return _table.erase(position); };
+
+        size_type erase(const key_type &k) { return _table.erase(k); };
+
+        template <class K>
+        typename table_type::template if_transparent<K, size_type>::type erase(const K &k) { return _table.erase(k); };
+
+        iterator erase(const_iterator first, const_iterator last) { return _table.erase(first, last); };
+
+        void clear() { _table.clear(); };
+
+        void swap(unordered_set &x) { _table.swap(x._table); };
+
+        iterator find(const key_type &k) const { return _table.find(k); };
+
+        template <class K>
+        typename table_type::template if_transparent<K, iterator>::type find(const K &k) const { return _table.find(k); };
+
+        size_type count(const key_type &k) const { return _table.count(k); };
+
+        template <class K>
+        typename table_type::template if_transparent<K, size_type>::type count(const K &k) const { return _table.count(k); };
+
+        ft::pair<iterator, iterator> equal_range(const key_type &k) const
+        {
+            iterator it = _table.find(k);
+            return ft::make_pair(it, it == end() ? it : ++iterator(it));
+        };
+
+        size_type bucket_count() const { return _table.bucket_count(); };
+
+        float load_factor() const { return _table.load_factor(); };
+
+        float max_load_factor() const { return _table.max_load_factor(); };
+
+        void rehash(size_type n) { _table.rehash(n); };
+
+        void reserve(size_type n) { _table.reserve(n); };
+
+        hasher hash_function() const { return _table.hash_function(); };
+
+        key_equal key_eq() const { return _table.key_eq(); };
+
+        allocator_type get_allocator() const { return _table.get_allocator(); };
+    };
+
+    template <class Key, class Hash, class KeyEqual, class Alloc>
+    bool operator==(const unordered_set<Key, Hash, KeyEqual, Alloc> &lhs, const unordered_set<Key, Hash, KeyEqual, Alloc> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (typename unordered_set<Key, Hash, KeyEqual, Alloc>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+            if (rhs.count(*it) == 0)
+                return false;
+        return true;
+    }
+
+    template <class Key, class Hash, class KeyEqual, class Alloc>
+    bool operator!=(const unordered_set<Key, Hash, KeyEqual, Alloc> &lhs, const unordered_set<Key, Hash, KeyEqual, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class Hash, class KeyEqual, class Alloc>
+    void swap(unordered_set<Key, Hash, KeyEqual, Alloc> &x, unordered_set<Key, Hash, KeyEqual, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+}
+
+#endif
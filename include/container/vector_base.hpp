@@ -0,0 +1,529 @@
+#ifndef VECTOR_BASE_HPP
+#define VECTOR_BASE_HPP
+
+#include <memory>
+#include <stdexcept>
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+#include "util/type_traits.hpp"
+
+#include "memory/uninitialized.hpp"
+
+#include "container/growth_policy.hpp"
+
+#include "iterator/vector_iterator.hpp"
+
+#include "iterator/reverse_iterator.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Element management shared by ft::vector and ft::small_vector.
+     *
+     * Holds the [start, finish, end_of_storage) triple and every operation
+     * that only reads or grows it. Growth builds the new elements in a fresh
+     * block and relocates the old ones around them before the old block is
+     * handed back, so a throwing element leaves the container unchanged.
+     * Blocks are handed back through Derived::release(start, capacity), which
+     * lets small_vector keep its inline buffer; construction, destruction,
+     * copy, move and swap stay with the derived class.
+     */
+    template <class Derived, class T, class Allocator, class GrowthPolicy>
+    class vector_base
+    {
+    public:
+        typedef T value_type;
+
+        typedef Allocator allocator_type;
+
+        typedef typename allocator_type::reference reference;
+
+        typedef typename allocator_type::const_reference const_reference;
+
+        typedef typename allocator_type::pointer pointer;
+
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef typename ft::vector_iterator<value_type> iterator;
+
+        typedef typename ft::vector_iterator<const value_type> const_iterator;
+
+        typedef typename ft::reverse_iterator<iterator> reverse_iterator;
+
+        typedef typename ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        typedef typename allocator_type::difference_type difference_type;
+
+        typedef typename allocator_type::size_type size_type;
+
+        typedef GrowthPolicy growth_policy;
+
+        iterator begin() { return iterator(_start); };
+
+        iterator end() { return iterator(_finish); };
+
+        const_iterator begin() const { return const_iterator(_start); };
+
+        const_iterator end() const { return const_iterator(_finish); };
+
+        reverse_iterator rbegin() { return reverse_iterator(end()); };
+
+        reverse_iterator rend() { return reverse_iterator(begin()); };
+
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); };
+
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); };
+
+        size_type size() const { return _finish - _start; };
+
+        size_type max_size() const { return _alloc.max_size(); };
+
+        void resize(size_type n, const_reference val = value_type())
+        {
+            const size_type _size = size();
+            if (n <= _size)
+            {
+                ft::destroy(_start + n, _finish);
+                _finish = _start + n;
+                return;
+            }
+
+            const size_type _capacity = capacity();
+            const size_type required = n - _size;
+            if (n <= _capacity)
+            {
+                _finish = ft::uninitialized_fill_n(_finish, required, val);
+                return;
+            }
+
+            const size_type new_capacity = next_capacity(n);
+            const pointer new_start = _alloc.allocate(new_capacity);
+            try
+            {
+                ft::uninitialized_fill_n(new_start + _size, required, val);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, new_capacity);
+                throw;
+            }
+            adopt(new_start, new_capacity, _size, required);
+        };
+
+        size_type capacity() const { return _end_of_storage - _start; };
+
+        bool empty() const { return _finish == _start; };
+
+        void reserve(size_type n)
+        {
+            const size_type _capacity = capacity();
+            if (n <= _capacity)
+                return;
+
+            adopt(_alloc.allocate(n), n, size(), 0);
+        };
+
+        reference operator[](size_type n) { return _start[n]; };
+
+        const_reference operator[](size_type n) const { return _start[n]; };
+
+        reference at(size_type n)
+        {
+            if (n >= size())
+                throw std::out_of_range("vector::at");
+            return _start[n];
+        };
+
+        const_reference at(size_type n) const
+        {
+            if (n >= size())
+                throw std::out_of_range("vector::at");
+            return _start[n];
+        };
+
+        reference front() { return _start[0]; };
+
+        const_reference front() const { return _start[0]; };
+
+        reference back() { return _finish[-1]; };
+
+        const_reference back() const { return _finish[-1]; };
+
+        template <class InputIterator>
+        void assign(InputIterator first, InputIterator last,
+                    typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL)
+        {
+            if (first == last)
+            {
+                clear();
+                return;
+            }
+
+            const size_type n = std::distance(first, last);
+            if (n <= capacity())
+            {
+                clear();
+                _finish = ft::uninitialized_copy(first, last, _start);
+                return;
+            }
+
+            // The old elements go only once the new block is complete.
+            const pointer new_start = _alloc.allocate(n);
+            try
+            {
+                ft::uninitialized_copy(first, last, new_start);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, n);
+                throw;
+            }
+            replace_storage(new_start, n, n);
+        };
+
+        void assign(size_type n, const value_type &val)
+        {
+            const value_type copy(val);
+            if (n <= capacity())
+            {
+                clear();
+                _finish = ft::uninitialized_fill_n(_start, n, copy);
+                return;
+            }
+
+            const pointer new_start = _alloc.allocate(n);
+            try
+            {
+                ft::uninitialized_fill_n(new_start, n, copy);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, n);
+                throw;
+            }
+            replace_storage(new_start, n, n);
+        };
+
+        void push_back(const_reference val)
+        {
+            if (_finish != _end_of_storage)
+            {
+                ::new (static_cast<void *>(_finish)) value_type(val);
+                ++_finish;
+                return;
+            }
+
+            const size_type _size = size();
+            const size_type new_capacity = next_capacity(_size + 1);
+            const pointer new_start = _alloc.allocate(new_capacity);
+            try
+            {
+                ::new (static_cast<void *>(new_start + _size)) value_type(val);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, new_capacity);
+                throw;
+            }
+            adopt(new_start, new_capacity, _size, 1);
+        }
+
+#if __cplusplus >= 201103L
+        void push_back(value_type &&val) { emplace_back(std::move(val)); };
+
+        template <class... Args>
+        void emplace_back(Args &&...args)
+        {
+            if (_finish != _end_of_storage)
+            {
+                ::new (static_cast<void *>(_finish)) value_type(std::forward<Args>(args)...);
+                ++_finish;
+                return;
+            }
+
+            // The new element is built before relocating so that arguments
+            // referring into this vector are still valid.
+            const size_type _size = size();
+            const size_type new_capacity = next_capacity(_size + 1);
+            const pointer new_start = _alloc.allocate(new_capacity);
+            try
+            {
+                ::new (static_cast<void *>(new_start + _size)) value_type(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, new_capacity);
+                throw;
+            }
+            adopt(new_start, new_capacity, _size, 1);
+        };
+
+        template <class... Args>
+        iterator emplace(iterator position, Args &&...args)
+        {
+            const difference_type distance = position - begin();
+            if (position == end())
+            {
+                emplace_back(std::forward<Args>(args)...);
+                return begin() + distance;
+            }
+
+            const pointer pos = _start + distance;
+            if (capacity() > size())
+            {
+                value_type value(std::forward<Args>(args)...);
+                ft::relocate_backward(pos, _finish, _finish + 1);
+                try
+                {
+                    ::new (static_cast<void *>(pos)) value_type(std::move(value));
+                }
+                catch (...)
+                {
+                    drop_gap(pos, 1);
+                    throw;
+                }
+                ++_finish;
+                return position;
+            }
+
+            const size_type new_capacity = next_capacity(size() + 1);
+            const pointer new_start = _alloc.allocate(new_capacity);
+            try
+            {
+                ::new (static_cast<void *>(new_start + distance)) value_type(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, new_capacity);
+                throw;
+            }
+            adopt(new_start, new_capacity, distance, 1);
+            return iterator(new_start + distance);
+        };
+
+        iterator insert(iterator position, value_type &&val) { return emplace(position, std::move(val)); };
+#endif
+
+        void pop_back()
+        {
+            if (empty())
+                throw std::out_of_range("ft::vector::pop_back");
+            --_finish;
+            _finish->~value_type();
+        }
+
+        iterator insert(iterator position, const value_type &val)
+        {
+            if (position == end())
+            {
+                push_back(val);
+                return end() - 1;
+            }
+
+            const pointer pos = _start + (position - begin());
+            if (capacity() > size())
+            {
+                const value_type copy(val);
+                ft::relocate_backward(pos, _finish, _finish + 1);
+                try
+                {
+                    ::new (static_cast<void *>(pos)) value_type(copy);
+                }
+                catch (...)
+                {
+                    drop_gap(pos, 1);
+                    throw;
+                }
+                ++_finish;
+                return position;
+            }
+
+            const difference_type distance = pos - _start;
+            const size_type new_capacity = next_capacity(size() + 1);
+            const pointer new_start = _alloc.allocate(new_capacity);
+            try
+            {
+                ::new (static_cast<void *>(new_start + distance)) value_type(val);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, new_capacity);
+                throw;
+            }
+            adopt(new_start, new_capacity, distance, 1);
+            return iterator(new_start + distance);
+        };
+
+        void insert(iterator position, size_type n, const value_type &val)
+        {
+            const size_type _size = size();
+            const size_type _capacity = capacity();
+            const std::size_t available = _capacity - _size;
+            const pointer pos = _start + (position - begin());
+            const value_type copy(val);
+
+            if (n <= available)
+            {
+                ft::relocate_backward(pos, _finish, _finish + n);
+                try
+                {
+                    ft::uninitialized_fill_n(pos, n, copy);
+                }
+                catch (...)
+                {
+                    drop_gap(pos, n);
+                    throw;
+                }
+                _finish += n;
+                return ;
+            }
+
+            const size_type new_capacity = next_capacity(_size + n);
+            const difference_type distance = pos - _start;
+            const pointer new_start = _alloc.allocate(new_capacity);
+            try
+            {
+                ft::uninitialized_fill_n(new_start + distance, n, copy);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, new_capacity);
+                throw;
+            }
+            adopt(new_start, new_capacity, distance, n);
+        };
+
+        template <class InputIterator>
+        void insert(iterator position, InputIterator first, InputIterator last,
+                    typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = NULL)
+        {
+            const difference_type distance = std::distance(first, last);
+            const difference_type available = capacity() - size();
+            const pointer pos = _start + (position - begin());
+
+            if (distance <= available)
+            {
+                ft::relocate_backward(pos, _finish, _finish + distance);
+                try
+                {
+                    ft::uninitialized_copy(first, last, pos);
+                }
+                catch (...)
+                {
+                    drop_gap(pos, distance);
+                    throw;
+                }
+                _finish += distance;
+                return;
+            }
+
+            const size_type new_capacity = next_capacity(size() + distance);
+            const difference_type offset = pos - _start;
+            const pointer new_start = _alloc.allocate(new_capacity);
+            try
+            {
+                ft::uninitialized_copy(first, last, new_start + offset);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_start, new_capacity);
+                throw;
+            }
+            adopt(new_start, new_capacity, offset, distance);
+        };
+
+        iterator erase(iterator position)
+        {
+            return erase(position, position + 1);
+        };
+
+        iterator erase(iterator first, iterator last)
+        {
+            if (first == last)
+                return first;
+            const pointer new_finish = std::copy(_start + (last - begin()), _finish, _start + (first - begin()));
+            ft::destroy(new_finish, _finish);
+            _finish = new_finish;
+            return first;
+        };
+
+        void clear()
+        {
+            ft::destroy(_start, _finish);
+            _finish = _start;
+        };
+
+        allocator_type get_allocator() const { return _alloc; };
+
+    protected:
+        explicit vector_base(allocator_type const &alloc) :
+            _alloc(alloc), _start(), _finish(), _end_of_storage() {};
+
+        // Moves the elements into new_start around the n elements already
+        // built at offset, then takes over the block. If a move throws, those
+        // n elements and the block are released and *this is unchanged.
+        void adopt(pointer new_start, size_type new_capacity, size_type offset, size_type n)
+        {
+            pointer new_finish;
+            try
+            {
+                new_finish = ft::relocate_around(_start, _start + offset, _finish, new_start, n);
+            }
+            catch (...)
+            {
+                ft::destroy(new_start + offset, new_start + offset + n);
+                _alloc.deallocate(new_start, new_capacity);
+                throw;
+            }
+            derived().release(_start, capacity());
+            _start = new_start;
+            _finish = new_finish;
+            _end_of_storage = new_start + new_capacity;
+        }
+
+        // Destroys the elements and frees the block in favour of new_start,
+        // which holds size live elements.
+        void replace_storage(pointer new_start, size_type size, size_type new_capacity)
+        {
+            ft::destroy(_start, _finish);
+            derived().release(_start, capacity());
+            _start = new_start;
+            _finish = new_start + size;
+            _end_of_storage = new_start + new_capacity;
+        }
+
+        // Filling the n slots opened at pos failed. The elements shifted past
+        // them cannot be moved back without risking another throw, so they
+        // are dropped: the vector keeps [begin, pos).
+        void drop_gap(pointer pos, size_type n)
+        {
+            ft::destroy(pos + n, _finish + n);
+            _finish = pos;
+        }
+
+        // Capacity to move to when `required` elements no longer fit.
+        size_type next_capacity(size_type required) const
+        {
+            const size_type limit = max_size();
+            if (required > limit)
+                throw std::length_error("vector");
+            return growth_policy::next_capacity(capacity(), required, sizeof(value_type), limit);
+        }
+
+        Derived &derived() { return static_cast<Derived &>(*this); }
+
+        allocator_type _alloc;
+
+        pointer _start;
+
+        pointer _finish;
+
+        pointer _end_of_storage;
+    };
+
+}
+
+#endif
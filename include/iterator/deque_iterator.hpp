@@ -0,0 +1,228 @@
+#ifndef DEQUE_ITERATOR_HPP
+#define DEQUE_ITERATOR_HPP
+
+#include "iterator/iterator.hpp"
+#include "util/type_traits.hpp"
+#include <iterator>
+
+namespace ft
+{
+
+  /// Elements per ft::deque chunk: a 4 KiB page, and at least 16.
+  inline std::size_t __deque_chunk_size(std::size_t element_size)
+  {
+    return element_size < 256 ? 4096 / element_size : 16;
+  }
+
+  /**
+   * @brief Random access iterator over an ft::deque: the current element,
+   * the bounds of its chunk and the chunk's slot in the chunk map. Stepping
+   * stays inside the chunk until a bound is crossed, then hops to the
+   * neighbouring map slot.
+   */
+  template <class T>
+  class deque_iterator : public ft::iterator<ft::random_access_iterator_tag, T>
+  {
+  public:
+
+    typedef typename std::random_access_iterator_tag iterator_category;
+
+    typedef typename ft::iterator<ft::random_access_iterator_tag, T>::value_type value_type;
+
+    typedef typename ft::iterator<ft::random_access_iterator_tag, T>::difference_type difference_type;
+
+    typedef typename ft::iterator<ft::random_access_iterator_tag, T>::pointer pointer;
+
+    typedef typename ft::iterator<ft::random_access_iterator_tag, T>::reference reference;
+
+    typedef typename ft::remove_const<T>::type **map_pointer;
+
+    deque_iterator() : _cur(), _first(), _last(), _node() {}
+
+    deque_iterator(pointer cur, map_pointer node) : _cur(cur), _first(*node), _last(*node + chunk_size()), _node(node) {}
+
+    deque_iterator(const deque_iterator &other)
+      : _cur(other._cur), _first(other._first), _last(other._last), _node(other._node) {}
+
+    // iterator -> const_iterator conversion.
+    template <class U>
+    deque_iterator(const deque_iterator<U> &other,
+                   typename ft::enable_if<ft::is_same<const U, T>::value && !ft::is_same<U, T>::value>::type * = NULL)
+      : _cur(other.base()), _first(other.chunk_begin()), _last(other.chunk_end()), _node(other.node()) {}
+
+    deque_iterator &operator=(const deque_iterator &other)
+    {
+      _cur = other._cur;
+      _first = other._first;
+      _last = other._last;
+      _node = other._node;
+      return *this;
+    }
+
+    ~deque_iterator() {}
+
+    static difference_type chunk_size()
+    {
+      return static_cast<difference_type>(__deque_chunk_size(sizeof(value_type)));
+    }
+
+    bool operator==(const deque_iterator &other) const
+    {
+      return _cur == other._cur;
+    }
+
+    bool operator!=(const deque_iterator &other) const
+    {
+      return _cur != other._cur;
+    }
+
+    reference operator*() const
+    {
+      return *_cur;
+    }
+
+    pointer operator->() const
+    {
+      return _cur;
+    }
+
+    deque_iterator &operator++()
+    {
+      if (++_cur == _last)
+      {
+        set_node(_node + 1);
+        _cur = _first;
+      }
+      return *this;
+    }
+
+    deque_iterator operator++(int)
+    {
+      deque_iterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    deque_iterator &operator--()
+    {
+      if (_cur == _first)
+      {
+        set_node(_node - 1);
+        _cur = _last;
+      }
+      --_cur;
+      return *this;
+    }
+
+    deque_iterator operator--(int)
+    {
+      deque_iterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    deque_iterator &operator+=(const difference_type &n)
+    {
+      const difference_type offset = n + (_cur - _first);
+      if (offset >= 0 && offset < chunk_size())
+      {
+        _cur += n;
+        return *this;
+      }
+      const difference_type node_offset = offset > 0
+        ? offset / chunk_size()
+        : -((-offset - 1) / chunk_size()) - 1;
+      set_node(_node + node_offset);
+      _cur = _first + (offset - node_offset * chunk_size());
+      return *this;
+    }
+
+    deque_iterator &operator-=(const difference_type &n)
+    {
+      return *this += -n;
+    }
+
+    deque_iterator operator+(const difference_type &n) const
+    {
+      deque_iterator tmp(*this);
+      return tmp += n;
+    }
+
+    deque_iterator operator-(const difference_type &n) const
+    {
+      deque_iterator tmp(*this);
+      return tmp -= n;
+    }
+
+    difference_type operator-(const deque_iterator &other) const
+    {
+      return chunk_size() * (_node - other._node - 1) + (_cur - _first) + (other._last - other._cur);
+    }
+
+    bool operator<(const deque_iterator &other) const
+    {
+      return _node == other._node ? _cur < other._cur : _node < other._node;
+    }
+
+    bool operator>(const deque_iterator &other) const
+    {
+      return other < *this;
+    }
+
+    bool operator<=(const deque_iterator &other) const
+    {
+      return !(other < *this);
+    }
+
+    bool operator>=(const deque_iterator &other) const
+    {
+      return !(*this < other);
+    }
+
+    reference operator[](const difference_type &n) const
+    {
+      return *(*this + n);
+    }
+
+    pointer base() const
+    {
+      return _cur;
+    }
+
+    pointer chunk_begin() const
+    {
+      return _first;
+    }
+
+    pointer chunk_end() const
+    {
+      return _last;
+    }
+
+    map_pointer node() const
+    {
+      return _node;
+    }
+
+    void set_node(map_pointer node)
+    {
+      _node = node;
+      _first = *node;
+      _last = _first + chunk_size();
+    }
+
+    void set_cur(pointer cur)
+    {
+      _cur = cur;
+    }
+
+  private:
+    pointer _cur;
+    pointer _first;
+    pointer _last;
+    map_pointer _node;
+  };
+
+}
+
+#endif
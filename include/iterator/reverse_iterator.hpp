@@ -115,7 +115,7 @@ namespace ft
 
     reverse_iterator operator-(const difference_type &n) const { return reverse_iterator(_value + n); }
 
-    difference_type operator-(const reverse_iterator &other) const { return _value - other._value; }
+    difference_type operator-(const reverse_iterator &other) const { return other._value - _value; }
 
   private:
 
@@ -129,31 +129,31 @@ namespace ft
 
   template< class Iterator1, class Iterator2 >
   bool operator!=(const ft::reverse_iterator<Iterator1>& lhs, const ft::reverse_iterator<Iterator2>& rhs)
-  { return lhs.base() == rhs.base(); };
+  { return lhs.base() != rhs.base(); };
 
   template< class Iterator1, class Iterator2 >
   bool operator<(const ft::reverse_iterator<Iterator1>& lhs, const ft::reverse_iterator<Iterator2>& rhs)
-  { return lhs.base() == rhs.base(); };
+  { return lhs.base() > rhs.base(); };
 
   template< class Iterator1, class Iterator2 >
   bool operator<=(const ft::reverse_iterator<Iterator1>& lhs, const ft::reverse_iterator<Iterator2>& rhs)
-  { return lhs.base() == rhs.base(); };
+  { return lhs.base() >= rhs.base(); };
 
   template< class Iterator1, class Iterator2 >
   bool operator>(const ft::reverse_iterator<Iterator1>& lhs, const ft::reverse_iterator<Iterator2>& rhs)
-  { return lhs.base() == rhs.base(); };
+  { return lhs.base() < rhs.base(); };
 
   template< class Iterator1, class Iterator2 >
   bool operator>=(const ft::reverse_iterator<Iterator1>& lhs, const ft::reverse_iterator<Iterator2>& rhs)
-  { return lhs.base() == rhs.base(); };
+  { return lhs.base() <= rhs.base(); };
 
   template< class Iter >
   ft::reverse_iterator<Iter> operator+(typename reverse_iterator<Iter>::difference_type n, const reverse_iterator<Iter>& it)
-  { return reverse_iterator<Iter>(it.base() + n); }
+  { return reverse_iterator<Iter>(it.base() - n); }
 
   template< class Iterator >
   typename reverse_iterator<Iterator>::difference_type operator-(const reverse_iterator<Iterator>& lhs, const reverse_iterator<Iterator>& rhs)
-  { return lhs.base() - rhs.base(); }
+  { return rhs.base() - lhs.base(); }
 
 }
 
@@ -2,6 +2,7 @@
 #define VECTOR_ITEARTOR_HPP
 
 #include "iterator/iterator.hpp"
+#include "util/type_traits.hpp"
 #include <iterator>
 
 namespace ft
@@ -28,6 +29,12 @@ namespace ft
 
     vector_iterator(const vector_iterator &other) : _value(other._value) {}
 
+    // iterator -> const_iterator conversion.
+    template <class U>
+    vector_iterator(const vector_iterator<U> &other,
+                    typename ft::enable_if<ft::is_same<const U, T>::value && !ft::is_same<U, T>::value>::type * = NULL)
+      : _value(other.base()) {}
+
     vector_iterator &operator=(const vector_iterator &other)
     {
       _value = other._value;
@@ -134,6 +141,11 @@ namespace ft
       return *(_value + n);
     }
 
+    pointer base() const
+    {
+      return _value;
+    }
+
   private:
     pointer _value;
   };
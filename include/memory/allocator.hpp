@@ -1,11 +1,12 @@
 #ifndef ALLOCATOR_HPP
 # define ALLOCATOR_HPP
 
-# include <stdlib.h>
 # include <new>
 # include <memory>
 # include <cstddef>
 
+# include "util/type_traits.hpp"
+
 namespace ft
 {
 
@@ -62,16 +63,14 @@ namespace ft
       if (n > max_size)
         throw std::bad_alloc();
 
-      void *const ptr = malloc(n * sizeof(T));
-      if (!ptr)
-        throw std::bad_alloc();
-
-      return static_cast<pointer>(ptr);
+      // Through the global operator new, like std::allocator, so that a
+      // replaced operator new sees ft storage as well.
+      return static_cast<pointer>(::operator new(n * sizeof(T)));
     }
 
     void deallocate(const_pointer ptr, size_type) const throw()
     {
-      free((void *)ptr);
+      ::operator delete(const_cast<void *>(static_cast<const void *>(ptr)));
     }
 
     void destroy(pointer ptr) const
@@ -85,6 +84,14 @@ namespace ft
     }
   };
 
+  /**
+   * @brief Whether the blocks returned by one allocate(n) call may be given
+   * back one at a time with deallocate(p, 1). Node containers use this to
+   * grab all their nodes with a single allocation when they can.
+   */
+  template <class Alloc>
+  struct allows_partial_deallocation : public false_type { };
+
 }
 
 #endif
@@ -0,0 +1,209 @@
+#ifndef ARENA_ALLOCATOR_HPP
+# define ARENA_ALLOCATOR_HPP
+
+# include <new>
+# include <cstddef>
+
+# include "memory/allocator.hpp"
+
+# include "util/type_traits.hpp"
+
+namespace ft
+{
+
+  /**
+   * @brief Monotonic memory arena: allocation bumps a pointer inside the
+   * current block, deallocation does nothing, and everything is handed back
+   * at once by release() or by the destructor.
+   *
+   * The arena may start from a caller-provided buffer (e.g. on the stack);
+   * further blocks come from @c Upstream and grow geometrically, so the
+   * number of upstream calls stays logarithmic in the bytes served.
+   */
+  template <class Upstream = ft::allocator<char> >
+  class basic_arena
+  {
+  public:
+    typedef Upstream upstream_type;
+
+    explicit basic_arena(std::size_t block_size = 4096, const upstream_type &upstream = upstream_type())
+      : _current(), _end(), _blocks(), _next_block_size(block_size), _upstream(upstream),
+        _buffer(), _buffer_size() {}
+
+    basic_arena(void *buffer, std::size_t size, std::size_t block_size = 4096,
+                const upstream_type &upstream = upstream_type())
+      : _current(static_cast<char *>(buffer)), _end(static_cast<char *>(buffer) + size), _blocks(),
+        _next_block_size(block_size), _upstream(upstream), _buffer(static_cast<char *>(buffer)),
+        _buffer_size(size) {}
+
+    ~basic_arena() { release(); }
+
+    void *allocate(std::size_t bytes, std::size_t align)
+    {
+      char *ptr = align_up(_current, align);
+      // The padding alone may already overshoot the end of the block.
+      if (_current == NULL || ptr > _end || bytes > static_cast<std::size_t>(_end - ptr))
+      {
+        grow(bytes + align);
+        ptr = align_up(_current, align);
+      }
+      _current = ptr + bytes;
+      return ptr;
+    }
+
+    /// Returns every upstream block at once and rewinds to the initial buffer.
+    void release()
+    {
+      while (_blocks != NULL)
+      {
+        block *b = _blocks;
+        _blocks = b->next;
+        _upstream.deallocate(reinterpret_cast<char *>(b), b->size);
+      }
+      _current = _buffer;
+      _end = _buffer + _buffer_size;
+    }
+
+    upstream_type upstream() const { return _upstream; }
+
+  private:
+    struct block
+    {
+      block *next;
+      std::size_t size;
+    };
+
+    // Keeps the first byte after a block header at malloc alignment.
+    static const std::size_t block_header = 16;
+
+    char *_current;
+
+    char *_end;
+
+    block *_blocks;
+
+    std::size_t _next_block_size;
+
+    upstream_type _upstream;
+
+    char *_buffer;
+
+    std::size_t _buffer_size;
+
+    basic_arena(const basic_arena &);
+
+    basic_arena &operator=(const basic_arena &);
+
+    static char *align_up(char *ptr, std::size_t align)
+    {
+      const std::size_t misalignment = reinterpret_cast<std::size_t>(ptr) % align;
+      return misalignment == 0 ? ptr : ptr + (align - misalignment);
+    }
+
+    void grow(std::size_t bytes)
+    {
+      std::size_t size = _next_block_size;
+      if (size < bytes + block_header)
+        size = bytes + block_header;
+      else
+        _next_block_size *= 2;
+      block *b = reinterpret_cast<block *>(_upstream.allocate(size));
+      b->next = _blocks;
+      b->size = size;
+      _blocks = b;
+      _current = reinterpret_cast<char *>(b) + block_header;
+      _end = reinterpret_cast<char *>(b) + size;
+    }
+  };
+
+  typedef basic_arena<> arena;
+
+  /**
+   * @brief Standard allocator interface over a basic_arena, usable as the
+   * allocator of ft::vector, ft::stack's container or ft::rb_tree.
+   *
+   * Allocators built from the same arena (including rebound copies) compare
+   * equal; deallocate is a no-op, memory comes back with the arena.
+   */
+  template <class T, class Arena = ft::arena>
+  class arena_allocator
+  {
+  public:
+    typedef T value_type;
+
+    typedef T *pointer;
+
+    typedef const T *const_pointer;
+
+    typedef T &reference;
+
+    typedef const T &const_reference;
+
+    typedef std::size_t size_type;
+
+    typedef ptrdiff_t difference_type;
+
+    template <class Type>
+    struct rebind
+    {
+      typedef arena_allocator<Type, Arena> other;
+    };
+
+    arena_allocator(Arena &arena) throw() : _arena(&arena) {}
+
+    arena_allocator(const arena_allocator &other) throw() : _arena(other._arena) {}
+
+    template <class U>
+    arena_allocator(const arena_allocator<U, Arena> &other) throw() : _arena(other.arena()) {}
+
+    arena_allocator &operator=(const arena_allocator &other)
+    {
+      _arena = other._arena;
+      return *this;
+    }
+
+    template <class U>
+    bool operator==(const arena_allocator<U, Arena> &other) const throw() { return _arena == other.arena(); }
+
+    template <class U>
+    bool operator!=(const arena_allocator<U, Arena> &other) const throw() { return _arena != other.arena(); }
+
+    pointer address(reference value) const { return &value; }
+
+    const_pointer address(const_reference value) const { return &value; }
+
+    void construct(pointer place, const_reference value) { new (place) T(value); }
+
+    pointer allocate(size_type n, const void * = NULL) const
+    {
+      if (n == 0)
+        return NULL;
+      if (n > max_size())
+        throw std::bad_alloc();
+      return static_cast<pointer>(_arena->allocate(n * sizeof(T), ft::alignment_of<T>::value));
+    }
+
+    void deallocate(const_pointer, size_type) const throw() {}
+
+    void destroy(pointer ptr) const
+    {
+      ptr->~T();
+    }
+
+    size_type max_size() const throw()
+    {
+      return static_cast<size_type>(-1) / sizeof(T);
+    }
+
+    Arena *arena() const { return _arena; }
+
+  private:
+    Arena *_arena;
+  };
+
+  template <class T, class Arena>
+  struct allows_partial_deallocation<arena_allocator<T, Arena> > : public true_type { };
+
+}
+
+#endif
@@ -0,0 +1,293 @@
+#ifndef POOL_ALLOCATOR_HPP
+# define POOL_ALLOCATOR_HPP
+
+# include <new>
+# include <cstddef>
+
+# include "memory/allocator.hpp"
+
+# include "util/type_traits.hpp"
+
+namespace ft
+{
+
+  /**
+   * @brief Slab storage shared by every copy and rebind of a pool_allocator.
+   *
+   * Blocks of one size are carved out of large chunks and recycled through an
+   * intrusive free list, so allocating and releasing a node is a couple of
+   * pointer moves instead of an operator new/delete pair. Chunks are only
+   * returned to the system when the last allocator referencing the resource
+   * goes away.
+   *
+   * The reference count is atomic, so copies of an allocator may be made and
+   * dropped from different threads; allocate and deallocate on one resource
+   * still need the caller's synchronisation.
+   */
+  class pool_resource
+  {
+  public:
+    pool_resource() : _slabs(), _references(1) {}
+
+    ~pool_resource() { release(); }
+
+    void retain() { __atomic_add_fetch(&_references, 1, __ATOMIC_RELAXED); }
+
+    bool release_reference() { return __atomic_sub_fetch(&_references, 1, __ATOMIC_ACQ_REL) == 0; }
+
+    /// Returns @c n contiguous blocks of @c block_size bytes, aligned to
+    /// @c alignment (a power of two dividing @c block_size).
+    void *allocate(std::size_t block_size, std::size_t n, std::size_t alignment = chunk_header)
+    {
+      slab &s = find_slab(block_size, alignment);
+      if (n != 1)
+        return new_chunk(s, n);
+      if (s.free == NULL)
+        refill(s);
+      block *head = s.free;
+      s.free = head->next;
+      return head;
+    }
+
+    /// Gives @c n blocks back to the free list; each may later be reused alone.
+    void deallocate(void *ptr, std::size_t block_size, std::size_t n, std::size_t alignment = chunk_header)
+    {
+      slab &s = find_slab(block_size, alignment);
+      char *bytes = static_cast<char *>(ptr);
+      while (n-- > 0)
+      {
+        block *b = reinterpret_cast<block *>(bytes + n * block_size);
+        b->next = s.free;
+        s.free = b;
+      }
+    }
+
+    void release()
+    {
+      while (_slabs != NULL)
+      {
+        slab *s = _slabs;
+        _slabs = s->next;
+        while (s->chunks != NULL)
+        {
+          chunk *c = s->chunks;
+          s->chunks = c->next;
+          ::operator delete(c);
+        }
+        ::operator delete(s);
+      }
+    }
+
+  private:
+    struct block
+    {
+      block *next;
+    };
+
+    struct chunk
+    {
+      chunk *next;
+    };
+
+    struct slab
+    {
+      slab *next;
+      std::size_t block_size;
+      std::size_t alignment;
+      std::size_t chunk_blocks;
+      block *free;
+      chunk *chunks;
+    };
+
+    // Chunk headers are padded so that the first block keeps the 16-byte
+    // alignment of operator new. Slabs for over-aligned blocks pad further.
+    static const std::size_t chunk_header = 16;
+
+    static const std::size_t first_chunk_blocks = 16;
+
+    static const std::size_t max_chunk_bytes = 64 * 1024;
+
+    slab *_slabs;
+
+    std::size_t _references;
+
+    pool_resource(const pool_resource &);
+
+    pool_resource &operator=(const pool_resource &);
+
+    slab &find_slab(std::size_t block_size, std::size_t alignment)
+    {
+      if (alignment < chunk_header)
+        alignment = chunk_header;
+      for (slab *s = _slabs; s != NULL; s = s->next)
+        if (s->block_size == block_size && s->alignment == alignment)
+          return *s;
+
+      slab *s = static_cast<slab *>(::operator new(sizeof(slab)));
+      s->next = _slabs;
+      s->block_size = block_size;
+      s->alignment = alignment;
+      s->chunk_blocks = first_chunk_blocks;
+      s->free = NULL;
+      s->chunks = NULL;
+      _slabs = s;
+      return *s;
+    }
+
+    // The first block sits at the first multiple of s.alignment past the
+    // header, at most s.alignment bytes into the chunk.
+    static char *new_chunk(slab &s, std::size_t blocks)
+    {
+      if (blocks > (static_cast<std::size_t>(-1) - s.alignment) / s.block_size)
+        throw std::bad_alloc();
+      chunk *c = static_cast<chunk *>(::operator new(s.alignment + blocks * s.block_size));
+      c->next = s.chunks;
+      s.chunks = c;
+      const std::size_t first = reinterpret_cast<std::size_t>(c) + chunk_header;
+      return reinterpret_cast<char *>((first + s.alignment - 1) & ~(s.alignment - 1));
+    }
+
+    static void refill(slab &s)
+    {
+      const std::size_t blocks = s.chunk_blocks;
+      char *bytes = new_chunk(s, blocks);
+      if (s.chunk_blocks * 2 * s.block_size <= max_chunk_bytes)
+        s.chunk_blocks *= 2;
+      // Thread the free list in address order so consecutive allocations
+      // are laid out next to each other.
+      for (std::size_t index = blocks; index-- > 0;)
+      {
+        block *b = reinterpret_cast<block *>(bytes + index * s.block_size);
+        b->next = s.free;
+        s.free = b;
+      }
+    }
+  };
+
+  /**
+   * @brief Fixed-size node allocator backed by a pool_resource.
+   *
+   * Meant for node-based containers (rb_tree allocates one node at a time).
+   * Copies and rebound copies share the same resource and compare equal.
+   */
+  template <class T>
+  class pool_allocator
+  {
+  public:
+    typedef T value_type;
+
+    typedef T *pointer;
+
+    typedef const T *const_pointer;
+
+    typedef T &reference;
+
+    typedef const T &const_reference;
+
+    typedef std::size_t size_type;
+
+    typedef ptrdiff_t difference_type;
+
+    template <class Type>
+    struct rebind
+    {
+      typedef pool_allocator<Type> other;
+    };
+
+    pool_allocator() : _resource(new pool_resource()) {}
+
+    pool_allocator(const pool_allocator &other) throw() : _resource(other._resource) { _resource->retain(); }
+
+    template <class U>
+    pool_allocator(const pool_allocator<U> &other) throw() : _resource(other.resource()) { _resource->retain(); }
+
+    ~pool_allocator()
+    {
+      if (_resource->release_reference())
+        delete _resource;
+    }
+
+    pool_allocator &operator=(const pool_allocator &other)
+    {
+      other._resource->retain();
+      if (_resource->release_reference())
+        delete _resource;
+      _resource = other._resource;
+      return *this;
+    }
+
+    template <class U>
+    bool operator==(const pool_allocator<U> &other) const throw() { return _resource == other.resource(); }
+
+    template <class U>
+    bool operator!=(const pool_allocator<U> &other) const throw() { return _resource != other.resource(); }
+
+    pointer address(reference value) const { return &value; }
+
+    const_pointer address(const_reference value) const { return &value; }
+
+    void construct(pointer place, const_reference value) { new (place) T(value); }
+
+    pointer allocate(size_type n, const void * = NULL)
+    {
+      if (n == 0)
+        return NULL;
+      return static_cast<pointer>(_resource->allocate(block_size(), n, alignment()));
+    }
+
+    void deallocate(pointer ptr, size_type n)
+    {
+      if (ptr != NULL)
+        _resource->deallocate(ptr, block_size(), n, alignment());
+    }
+
+    void destroy(pointer ptr) const
+    {
+      ptr->~T();
+    }
+
+    size_type max_size() const throw()
+    {
+      return static_cast<size_type>(-1) / block_size();
+    }
+
+    pool_resource *resource() const { return _resource; }
+
+    /// Exchanges the resources without touching their reference counts.
+    void swap(pool_allocator &other) throw()
+    {
+      pool_resource *resource = _resource;
+      _resource = other._resource;
+      other._resource = resource;
+    }
+
+  private:
+    pool_resource *_resource;
+
+    static size_type alignment()
+    {
+      return ft::alignment_of<T>::value < ft::alignment_of<void *>::value
+        ? ft::alignment_of<void *>::value : ft::alignment_of<T>::value;
+    }
+
+    static size_type block_size()
+    {
+      const size_type align = alignment();
+      const size_type size = sizeof(T) < sizeof(void *) ? sizeof(void *) : sizeof(T);
+      return (size + align - 1) / align * align;
+    }
+  };
+
+  template <class T>
+  struct allows_partial_deallocation<pool_allocator<T> > : public true_type { };
+
+  // Found by argument-dependent lookup from the containers' swap.
+  template <class T>
+  void swap(pool_allocator<T> &x, pool_allocator<T> &y) throw()
+  {
+    x.swap(y);
+  }
+
+}
+
+#endif
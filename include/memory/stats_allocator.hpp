@@ -0,0 +1,181 @@
+#ifndef STATS_ALLOCATOR_HPP
+# define STATS_ALLOCATOR_HPP
+
+# include <cstddef>
+
+# include "memory/allocator.hpp"
+
+# include "util/type_traits.hpp"
+
+namespace ft
+{
+
+  /**
+   * @brief Counters filled in by stats_allocator: calls, bytes currently
+   * live, the high-water mark and a histogram of request sizes where
+   * bucket b counts requests of [2^b, 2^(b+1)) bytes (bucket 0 also takes
+   * empty requests, the last one everything larger).
+   */
+  struct allocation_stats
+  {
+    static const std::size_t bucket_count = 32;
+
+    std::size_t allocations;
+
+    std::size_t deallocations;
+
+    std::size_t bytes_allocated;
+
+    std::size_t bytes_live;
+
+    std::size_t peak_bytes;
+
+    std::size_t histogram[bucket_count];
+
+    allocation_stats() { reset(); }
+
+    void reset()
+    {
+      allocations = 0;
+      deallocations = 0;
+      bytes_allocated = 0;
+      bytes_live = 0;
+      peak_bytes = 0;
+      for (std::size_t b = 0; b < bucket_count; ++b)
+        histogram[b] = 0;
+    }
+
+    void record_allocation(std::size_t bytes)
+    {
+      ++allocations;
+      bytes_allocated += bytes;
+      bytes_live += bytes;
+      if (bytes_live > peak_bytes)
+        peak_bytes = bytes_live;
+      ++histogram[bucket(bytes)];
+    }
+
+    void record_deallocation(std::size_t bytes)
+    {
+      ++deallocations;
+      bytes_live = bytes > bytes_live ? 0 : bytes_live - bytes;
+    }
+
+    static std::size_t bucket(std::size_t bytes)
+    {
+      std::size_t b = 0;
+      while (bytes > 1 && b + 1 < bucket_count)
+      {
+        bytes >>= 1;
+        ++b;
+      }
+      return b;
+    }
+
+    /// Shared by every stats_allocator not given its own counters; the test
+    /// harness resets and reports it around each test.
+    static allocation_stats &global()
+    {
+      static allocation_stats stats;
+      return stats;
+    }
+  };
+
+  /**
+   * @brief Allocator adaptor that forwards to @c Alloc and records every
+   * allocate / deallocate in an allocation_stats (the global one unless
+   * another is passed in). Rebound copies, e.g. the node allocator of an
+   * rb_tree, keep reporting to the same counters. Not thread-safe.
+   */
+  template <class T, class Alloc = ft::allocator<T> >
+  class stats_allocator
+  {
+  public:
+    typedef typename Alloc::value_type value_type;
+
+    typedef typename Alloc::pointer pointer;
+
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef typename Alloc::reference reference;
+
+    typedef typename Alloc::const_reference const_reference;
+
+    typedef typename Alloc::size_type size_type;
+
+    typedef typename Alloc::difference_type difference_type;
+
+    typedef Alloc inner_allocator_type;
+
+    template <class Type>
+    struct rebind
+    {
+      typedef stats_allocator<Type, typename Alloc::template rebind<Type>::other> other;
+    };
+
+    stats_allocator() : _inner(), _stats(&allocation_stats::global()) {}
+
+    explicit stats_allocator(allocation_stats &stats, const Alloc &inner = Alloc()) : _inner(inner), _stats(&stats) {}
+
+    stats_allocator(const stats_allocator &other) : _inner(other._inner), _stats(other._stats) {}
+
+    template <class U, class OtherAlloc>
+    stats_allocator(const stats_allocator<U, OtherAlloc> &other) : _inner(other.inner()), _stats(&other.stats()) {}
+
+    ~stats_allocator() {}
+
+    stats_allocator &operator=(const stats_allocator &other)
+    {
+      _inner = other._inner;
+      _stats = other._stats;
+      return *this;
+    }
+
+    template <class U, class OtherAlloc>
+    bool operator==(const stats_allocator<U, OtherAlloc> &other) const { return _stats == &other.stats() && _inner == other.inner(); }
+
+    template <class U, class OtherAlloc>
+    bool operator!=(const stats_allocator<U, OtherAlloc> &other) const { return !(*this == other); }
+
+    pointer address(reference value) const { return &value; }
+
+    const_pointer address(const_reference value) const { return &value; }
+
+    void construct(pointer place, const_reference value) { _inner.construct(place, value); }
+
+    pointer allocate(size_type n, const void *hint = NULL)
+    {
+      const pointer p = _inner.allocate(n, hint);
+      if (p != pointer())
+        _stats->record_allocation(n * sizeof(value_type));
+      return p;
+    }
+
+    // Null blocks (empty requests, an empty container's storage) are not
+    // counted on either side.
+    void deallocate(pointer ptr, size_type n)
+    {
+      if (ptr != pointer())
+        _stats->record_deallocation(n * sizeof(value_type));
+      _inner.deallocate(ptr, n);
+    }
+
+    void destroy(pointer ptr) { _inner.destroy(ptr); }
+
+    size_type max_size() const throw() { return _inner.max_size(); }
+
+    const Alloc &inner() const { return _inner; }
+
+    allocation_stats &stats() const { return *_stats; }
+
+  private:
+    Alloc _inner;
+    allocation_stats *_stats;
+  };
+
+  template <class T, class Alloc>
+  struct allows_partial_deallocation<stats_allocator<T, Alloc> > : public allows_partial_deallocation<Alloc> { };
+
+}
+
+#endif
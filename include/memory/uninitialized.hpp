@@ -0,0 +1,233 @@
+#ifndef UNINITIALIZED_HPP
+# define UNINITIALIZED_HPP
+
+# include <cstring>
+# include <cstddef>
+# include <memory>
+# include <algorithm>
+# include <utility>
+
+# include "util/type_traits.hpp"
+
+namespace ft
+{
+
+  // Raw-storage algorithms used by the contiguous containers. Every one of
+  // them dispatches on ft::is_trivially_copyable so that ranges of PODs are
+  // moved with a single memcpy / memmove / memset instead of a per-element
+  // loop, while class types keep their constructor / destructor semantics.
+
+  template <class T>
+  T *__uninitialized_copy(const T *first, const T *last, T *dest, true_type)
+  {
+    const std::size_t n = last - first;
+    if (n != 0)
+      std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), n * sizeof(T));
+    return dest + n;
+  }
+
+  template <class T>
+  T *__uninitialized_copy(const T *first, const T *last, T *dest, false_type)
+  {
+    return std::uninitialized_copy(first, last, dest);
+  }
+
+  /// Copy-constructs [first, last) into raw storage starting at @c dest.
+  template <class InputIterator, class T>
+  T *uninitialized_copy(InputIterator first, InputIterator last, T *dest)
+  {
+    return std::uninitialized_copy(first, last, dest);
+  }
+
+  template <class T>
+  T *uninitialized_copy(const T *first, const T *last, T *dest)
+  {
+    return __uninitialized_copy(first, last, dest, is_trivially_copyable<T>());
+  }
+
+  template <class T>
+  T *uninitialized_copy(T *first, T *last, T *dest)
+  {
+    return __uninitialized_copy<T>(first, last, dest, is_trivially_copyable<T>());
+  }
+
+  template <class T>
+  bool __is_zero_bytes(const T &value)
+  {
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&value);
+    for (std::size_t index = 0; index < sizeof(T); ++index)
+      if (bytes[index] != 0)
+        return false;
+    return true;
+  }
+
+  template <class T>
+  T *__uninitialized_fill_n(T *dest, std::size_t n, const T &value, true_type)
+  {
+    if (n == 0)
+      return dest;
+    if (sizeof(T) == 1 || __is_zero_bytes(value))
+    {
+      unsigned char byte;
+      std::memcpy(&byte, &value, 1);
+      std::memset(static_cast<void *>(dest), byte, n * sizeof(T));
+    }
+    else
+      std::fill_n(dest, n, value);
+    return dest + n;
+  }
+
+  template <class T>
+  T *__uninitialized_fill_n(T *dest, std::size_t n, const T &value, false_type)
+  {
+    std::uninitialized_fill_n(dest, n, value);
+    return dest + n;
+  }
+
+  /// Copy-constructs @c n copies of @c value into raw storage at @c dest.
+  template <class T>
+  T *uninitialized_fill_n(T *dest, std::size_t n, const T &value)
+  {
+    return __uninitialized_fill_n(dest, n, value, is_trivially_copyable<T>());
+  }
+
+  template <class T>
+  void __destroy(T *, T *, true_type) {}
+
+  template <class T>
+  void __destroy(T *first, T *last, false_type)
+  {
+    for (; first != last; ++first)
+      first->~T();
+  }
+
+  /// Runs the destructor of every element in [first, last).
+  template <class T>
+  void destroy(T *first, T *last)
+  {
+    __destroy(first, last, is_trivially_copyable<T>());
+  }
+
+  // Relocation of class types moves when the element's move constructor
+  // cannot throw (C++11 builds) and copies otherwise: a copy leaves the
+  // source intact, so a relocation that throws part way can be undone.
+# if __cplusplus >= 201103L
+#  define FT_RELOCATION_SOURCE(x) std::move_if_noexcept(x)
+# else
+#  define FT_RELOCATION_SOURCE(x) (x)
+# endif
+
+  template <class T>
+  T *__relocate_around(T *first, T *pos, T *last, T *dest, std::size_t gap, true_type)
+  {
+    const std::size_t head = pos - first;
+    const std::size_t tail = last - pos;
+    if (head != 0)
+      std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), head * sizeof(T));
+    if (tail != 0)
+      std::memcpy(static_cast<void *>(dest + head + gap), static_cast<const void *>(pos), tail * sizeof(T));
+    return dest + head + gap + tail;
+  }
+
+  // Builds every copy before destroying any source, so that a throwing
+  // copy leaves the source range as it was.
+  template <class T>
+  T *__relocate_around(T *first, T *pos, T *last, T *dest, std::size_t gap, false_type)
+  {
+    T *const tail = dest + (pos - first) + gap;
+    T *head_built = dest;
+    T *tail_built = tail;
+    try
+    {
+      for (T *it = first; it != pos; ++it, ++head_built)
+        ::new (static_cast<void *>(head_built)) T(FT_RELOCATION_SOURCE(*it));
+      for (T *it = pos; it != last; ++it, ++tail_built)
+        ::new (static_cast<void *>(tail_built)) T(FT_RELOCATION_SOURCE(*it));
+    }
+    catch (...)
+    {
+      ft::destroy(dest, head_built);
+      ft::destroy(tail, tail_built);
+      throw;
+    }
+    ft::destroy(first, last);
+    return tail_built;
+  }
+
+  /**
+   * @brief Moves [first, pos) to @c dest and [pos, last) right after a gap
+   * of @c gap slots, leaving the source uninitialized and the gap untouched;
+   * returns the end of the moved range. The destination must not overlap
+   * the source. If a copy throws, the copies made so far are destroyed and
+   * the source is left intact.
+   */
+  template <class T>
+  T *relocate_around(T *first, T *pos, T *last, T *dest, std::size_t gap)
+  {
+    return __relocate_around(first, pos, last, dest, gap, is_trivially_copyable<T>());
+  }
+
+  /// relocate_around without a gap.
+  template <class T>
+  T *relocate(T *first, T *last, T *dest)
+  {
+    return relocate_around(first, last, last, dest, 0);
+  }
+
+  template <class T>
+  T *__relocate_backward(T *first, T *last, T *dest_last, true_type)
+  {
+    const std::size_t n = last - first;
+    if (n != 0)
+      std::memmove(static_cast<void *>(dest_last - n), static_cast<const void *>(first), n * sizeof(T));
+    return dest_last - n;
+  }
+
+  // The part of the destination past @c last is raw storage and is built
+  // first; the part overlapping the source is assigned, back to front. Only
+  // then are the vacated slots destroyed.
+  template <class T>
+  T *__relocate_backward(T *first, T *last, T *dest_last, false_type)
+  {
+    if (dest_last == last)
+      return first;
+    T *const dest_first = dest_last - (last - first);
+    T *const raw = dest_first > last ? dest_first : last;
+    T *built = dest_last;
+    T *source = last;
+    try
+    {
+      while (built != raw)
+      {
+        --built;
+        --source;
+        ::new (static_cast<void *>(built)) T(FT_RELOCATION_SOURCE(*source));
+      }
+      for (T *out = raw; source != first;)
+        *--out = FT_RELOCATION_SOURCE(*--source);
+    }
+    catch (...)
+    {
+      ft::destroy(built, dest_last);
+      throw;
+    }
+    ft::destroy(first, dest_first < last ? dest_first : last);
+    return dest_first;
+  }
+
+  /**
+   * @brief Moves [first, last) so that it ends at @c dest_last, walking from
+   * the back, and leaves the vacated slots uninitialized. The ranges may
+   * overlap as long as dest_last >= last. If a copy throws, nothing past
+   * @c last is left constructed and [first, last) still holds live
+   * elements, some of which may already have been shifted.
+   */
+  template <class T>
+  T *relocate_backward(T *first, T *last, T *dest_last)
+  {
+    return __relocate_backward(first, last, dest_last, is_trivially_copyable<T>());
+  }
+
+}
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Hardware counters for the calling thread, read through Linux
+// perf_event_open and counting user space only (so perf_event_paranoid up
+// to 2 is enough). Used by the test and benchmark runners to show whether a
+// layout change actually removes cache misses. Events the kernel or the
+// (virtual) machine does not provide are reported as unavailable; on other
+// systems every event is.
+struct perf_counters
+{
+    enum event
+    {
+        cycles,
+        instructions,
+        l1d_misses,
+        llc_misses,
+        branch_misses,
+        event_count
+    };
+
+    // A disabled set opens nothing and reports every event unavailable.
+    explicit perf_counters(bool enabled = true)
+    {
+        for (int e = 0; e < event_count; ++e)
+        {
+            _fd[e] = enabled ? open(static_cast<event>(e)) : -1;
+            _value[e] = 0;
+        }
+    }
+
+    ~perf_counters()
+    {
+#ifdef __linux__
+        for (int e = 0; e < event_count; ++e)
+            if (_fd[e] != -1)
+                close(_fd[e]);
+#endif
+    }
+
+    /// Whether at least one event could be opened.
+    bool available() const
+    {
+        for (int e = 0; e < event_count; ++e)
+            if (_fd[e] != -1)
+                return true;
+        return false;
+    }
+
+    bool available(event e) const
+    {
+        return _fd[e] != -1;
+    }
+
+    /// Zeroes and starts every counter.
+    void start()
+    {
+#ifdef __linux__
+        for (int e = 0; e < event_count; ++e)
+            if (_fd[e] != -1)
+            {
+                ioctl(_fd[e], PERF_EVENT_IOC_RESET, 0);
+                ioctl(_fd[e], PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+    }
+
+    /// Stops every counter and latches its value since start().
+    void stop()
+    {
+#ifdef __linux__
+        for (int e = 0; e < event_count; ++e)
+            if (_fd[e] != -1)
+                ioctl(_fd[e], PERF_EVENT_IOC_DISABLE, 0);
+        for (int e = 0; e < event_count; ++e)
+            _value[e] = read(_fd[e]);
+#endif
+    }
+
+    /// Count between the last start() / stop() pair, scaled up when the
+    /// kernel had to multiplex the counter.
+    double value(event e) const
+    {
+        return _value[e];
+    }
+
+    static const char *name(event e)
+    {
+        static const char *const names[event_count] = {"cycles", "instructions", "L1d-misses", "LLC-misses", "branch-misses"};
+        return names[e];
+    }
+
+    /// "cycles 123 instructions 456 ..." with "-" for unavailable events.
+    std::string report() const
+    {
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(0);
+        for (int e = 0; e < event_count; ++e)
+        {
+            if (e != 0)
+                line << " ";
+            line << name(static_cast<event>(e)) << " ";
+            if (available(static_cast<event>(e)))
+                line << _value[e];
+            else
+                line << "-";
+        }
+        return line.str();
+    }
+
+private:
+    int _fd[event_count];
+
+    double _value[event_count];
+
+    perf_counters(const perf_counters &);
+
+    perf_counters &operator=(const perf_counters &);
+
+#ifdef __linux__
+    static int open(event e)
+    {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        switch (e)
+        {
+        case cycles:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case instructions:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case l1d_misses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case llc_misses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        default:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        }
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    static double read(int fd)
+    {
+        if (fd == -1)
+            return 0;
+        unsigned long long data[3];
+        if (::read(fd, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0)
+            return 0;
+        return static_cast<double>(data[0]) * (static_cast<double>(data[1]) / static_cast<double>(data[2]));
+    }
+#else
+    static int open(event)
+    {
+        return -1;
+    }
+#endif
+};
+
+#endif
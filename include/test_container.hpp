@@ -10,7 +10,8 @@ struct test_container
 
     static std::map<std::string, test_function> tests;
     static bool register_test(std::string test, test_function result);
-    static void run();
+    // Wraps each test in perf_counters when with_counters is set.
+    static void run(bool with_counters = false);
     static void assert_true(bool condition, std::string message);
 };
 
@@ -0,0 +1,324 @@
+#ifndef FLAT_TREE_HPP
+#define FLAT_TREE_HPP
+
+#include <algorithm>
+#include <functional>
+
+#include "container/vector.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/pair.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Sorted sequence of unique keys stored contiguously in a random
+     * access Container (ft::vector by default). It is the flat counterpart of
+     * rb_tree behind ft::flat_set and ft::flat_map: lookups are binary
+     * searches over dense memory, single inserts and erases shift the tail,
+     * and range inserts append, sort and merge once.
+     */
+    template <typename T, typename Compare = std::less<T>, typename KeyOfValue = ft::identity<T>,
+              typename Container = ft::vector<T> >
+    class flat_tree
+    {
+    public:
+        typedef T value_type;
+        typedef typename KeyOfValue::result_type key_type;
+        typedef Compare key_compare;
+        typedef Container container_type;
+        typedef typename Container::size_type size_type;
+        typedef typename Container::difference_type difference_type;
+        typedef typename Container::iterator iterator;
+        typedef typename Container::const_iterator const_iterator;
+        typedef typename Container::reverse_iterator reverse_iterator;
+        typedef typename Container::const_reverse_iterator const_reverse_iterator;
+
+        // Orders two values by their keys.
+        class value_compare
+        {
+        public:
+            value_compare(const Compare &compare) : compare(compare) {}
+
+            bool operator()(const T &lhs, const T &rhs) const
+            {
+                return compare(KeyOfValue()(lhs), KeyOfValue()(rhs));
+            }
+
+        private:
+            Compare compare;
+        };
+
+    private:
+        Container _data;
+        Compare _compare;
+
+    public:
+        flat_tree() : _data(), _compare() {}
+
+        explicit flat_tree(const Compare &compare) : _data(), _compare(compare) {}
+
+        bool empty() const
+        {
+            return _data.empty();
+        }
+
+        size_type size() const
+        {
+            return _data.size();
+        }
+
+        size_type max_size() const
+        {
+            return _data.max_size();
+        }
+
+        size_type capacity() const
+        {
+            return _data.capacity();
+        }
+
+        void reserve(size_type n)
+        {
+            _data.reserve(n);
+        }
+
+        ft::pair<iterator, bool> insert_unique(const T &value)
+        {
+            const key_type &k = KeyOfValue()(value);
+            iterator position = lower_bound(k);
+            if (position != end() && !_compare(k, KeyOfValue()(*position)))
+                return ft::pair<iterator, bool>(position, false);
+            return ft::pair<iterator, bool>(_data.insert(position, value), true);
+        }
+
+        // A hint right after the new key (end() for ascending input) skips
+        // the binary search.
+        iterator insert_unique(const_iterator hint, const T &value)
+        {
+            const key_type &k = KeyOfValue()(value);
+            const difference_type index = hint - const_iterator(begin());
+            const bool after_previous = index == 0 || _compare(KeyOfValue()(_data[index - 1]), k);
+            const bool before_hint = hint == const_iterator(end()) || _compare(k, KeyOfValue()(*hint));
+            if (after_previous && before_hint)
+                return _data.insert(begin() + index, value);
+            return insert_unique(value).first;
+        }
+
+        // Appends the whole range, sorts only the new tail and merges it
+        // into place, so n inserts cost O(n log n + size()) instead of n
+        // tail shifts. Existing elements and earlier duplicates win.
+        template <typename InputIterator>
+        void insert_unique(InputIterator first, InputIterator last)
+        {
+            const size_type old_size = size();
+            for (; first != last; ++first)
+                _data.push_back(*first);
+            if (size() == old_size)
+                return;
+
+            const value_compare compare(_compare);
+            iterator middle = begin() + old_size;
+            std::stable_sort(middle, end(), compare);
+            if (middle != begin() && !compare(*(middle - 1), *middle))
+                std::inplace_merge(begin(), middle, end(), compare);
+            _data.erase(std::unique(begin(), end(), equivalent(compare)), end());
+        }
+
+        iterator erase(const_iterator position)
+        {
+            return _data.erase(begin() + (position - const_iterator(begin())));
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            const iterator base = begin();
+            return _data.erase(base + (first - const_iterator(base)), base + (last - const_iterator(base)));
+        }
+
+        size_type erase(const key_type &k)
+        {
+            iterator position = find(k);
+            if (position == end())
+                return 0;
+            _data.erase(position);
+            return 1;
+        }
+
+        size_type count(const key_type &k) const
+        {
+            return find(k) != end() ? 1 : 0;
+        }
+
+        iterator find(const key_type &k)
+        {
+            return begin() + find_index(k);
+        }
+
+        const_iterator find(const key_type &k) const
+        {
+            return begin() + find_index(k);
+        }
+
+        iterator lower_bound(const key_type &k)
+        {
+            return begin() + lower_bound_index(k);
+        }
+
+        const_iterator lower_bound(const key_type &k) const
+        {
+            return begin() + lower_bound_index(k);
+        }
+
+        iterator upper_bound(const key_type &k)
+        {
+            return begin() + upper_bound_index(k);
+        }
+
+        const_iterator upper_bound(const key_type &k) const
+        {
+            return begin() + upper_bound_index(k);
+        }
+
+        ft::pair<iterator, iterator> equal_range(const key_type &k)
+        {
+            iterator first = lower_bound(k);
+            iterator last = first;
+            if (last != end() && !_compare(k, KeyOfValue()(*last)))
+                ++last;
+            return ft::pair<iterator, iterator>(first, last);
+        }
+
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+        {
+            const_iterator first = lower_bound(k);
+            const_iterator last = first;
+            if (last != end() && !_compare(k, KeyOfValue()(*last)))
+                ++last;
+            return ft::pair<const_iterator, const_iterator>(first, last);
+        }
+
+        void clear()
+        {
+            _data.clear();
+        }
+
+        void swap(flat_tree &other)
+        {
+            _data.swap(other._data);
+            std::swap(_compare, other._compare);
+        }
+
+        iterator begin()
+        {
+            return _data.begin();
+        }
+
+        const_iterator begin() const
+        {
+            return _data.begin();
+        }
+
+        iterator end()
+        {
+            return _data.end();
+        }
+
+        const_iterator end() const
+        {
+            return _data.end();
+        }
+
+        reverse_iterator rbegin()
+        {
+            return _data.rbegin();
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return _data.rbegin();
+        }
+
+        reverse_iterator rend()
+        {
+            return _data.rend();
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return _data.rend();
+        }
+
+        Compare get_comparator() const
+        {
+            return _compare;
+        }
+
+        const Container &data() const
+        {
+            return _data;
+        }
+
+    protected:
+        // Adjacent-duplicate predicate for std::unique over a sorted range.
+        class equivalent
+        {
+        public:
+            equivalent(const value_compare &compare) : compare(compare) {}
+
+            bool operator()(const T &lhs, const T &rhs) const
+            {
+                return !compare(lhs, rhs);
+            }
+
+        private:
+            value_compare compare;
+        };
+
+        // Branch-free binary search: the loop only narrows [base, base + n)
+        // with a conditional move, so the compiler emits no unpredictable
+        // branch and the trip count is always ceil(log2(size())).
+        size_type lower_bound_index(const key_type &k) const
+        {
+            size_type n = size();
+            if (n == 0)
+                return 0;
+            size_type base = 0;
+            while (n > 1)
+            {
+                const size_type half = n / 2;
+                base = _compare(KeyOfValue()(_data[base + half]), k) ? base + half : base;
+                n -= half;
+            }
+            return base + (_compare(KeyOfValue()(_data[base]), k) ? 1 : 0);
+        }
+
+        size_type upper_bound_index(const key_type &k) const
+        {
+            size_type n = size();
+            if (n == 0)
+                return 0;
+            size_type base = 0;
+            while (n > 1)
+            {
+                const size_type half = n / 2;
+                base = !_compare(k, KeyOfValue()(_data[base + half])) ? base + half : base;
+                n -= half;
+            }
+            return base + (!_compare(k, KeyOfValue()(_data[base])) ? 1 : 0);
+        }
+
+        size_type find_index(const key_type &k) const
+        {
+            const size_type index = lower_bound_index(k);
+            if (index == size() || _compare(k, KeyOfValue()(_data[index])))
+                return size();
+            return index;
+        }
+    };
+
+}
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef FROZEN_INDEX_HPP
+#define FROZEN_INDEX_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+
+#include "container/vector.hpp"
+
+#include "util/functional.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+# define FT_PREFETCH(address) __builtin_prefetch(address)
+#else
+# define FT_PREFETCH(address) ((void)(address))
+#endif
+
+namespace ft
+{
+
+    /**
+     * @brief Immutable search index over a sorted sequence, stored in
+     * Eytzinger (breadth-first) order in one contiguous array: the children
+     * of slot k are slots 2k and 2k + 1 (1-based). The first levels of every
+     * search share the same few cache lines, the descent is branch-free, and
+     * each step prefetches the line holding the descendants four levels
+     * down, so a lookup no longer pays a dependent cache miss per level the
+     * way pointer-chasing an rb_tree does. Built by rb_tree::freeze().
+     *
+     * Results are pointers into the index (NULL when there is none): the
+     * layout is not in key order, so there are no iterators.
+     */
+    template <typename T, typename Compare = std::less<T>, typename KeyOfValue = ft::identity<T> >
+    class frozen_index
+    {
+    public:
+        typedef T value_type;
+        typedef typename KeyOfValue::result_type key_type;
+        typedef Compare key_compare;
+        typedef size_t size_type;
+
+    private:
+        ft::vector<T> _data;
+        Compare _compare;
+
+    public:
+        frozen_index() : _data(), _compare() {}
+
+        // [first, last) must be sorted by key.
+        template <typename ForwardIterator>
+        frozen_index(ForwardIterator first, ForwardIterator last, const Compare &compare = Compare())
+            : _data(), _compare(compare)
+        {
+            const size_type n = std::distance(first, last);
+            if (n == 0)
+                return;
+            // Lay out pointers first, then copy-construct each value once in
+            // slot order (values such as map pairs cannot be assigned).
+            ft::vector<const T *> slots(n);
+            fill(slots, first, 1);
+            _data.reserve(n);
+            for (size_type slot = 0; slot < n; ++slot)
+                _data.push_back(*slots[slot]);
+        }
+
+        bool empty() const
+        {
+            return _data.empty();
+        }
+
+        size_type size() const
+        {
+            return _data.size();
+        }
+
+        /// First element whose key is not less than @c k, or NULL.
+        const T *lower_bound(const key_type &k) const
+        {
+            const size_type slot = lower_bound_slot(k);
+            return slot == 0 ? NULL : &_data[slot - 1];
+        }
+
+        /// Element whose key is equivalent to @c k, or NULL.
+        const T *find(const key_type &k) const
+        {
+            const T *candidate = lower_bound(k);
+            if (candidate == NULL || _compare(k, KeyOfValue()(*candidate)))
+                return NULL;
+            return candidate;
+        }
+
+        /// Number of elements equivalent to @c k (several when frozen from
+        /// a multi-tree): the in-order walk from lower_bound over the run.
+        size_type count(const key_type &k) const
+        {
+            size_type result = 0;
+            for (size_type slot = lower_bound_slot(k); slot != 0 && !_compare(k, KeyOfValue()(_data[slot - 1]));
+                 slot = next_slot(slot))
+                ++result;
+            return result;
+        }
+
+        void swap(frozen_index &other)
+        {
+            _data.swap(other._data);
+            std::swap(_compare, other._compare);
+        }
+
+    private:
+        // 1-based slot of lower_bound(k), 0 when there is none.
+        size_type lower_bound_slot(const key_type &k) const
+        {
+            const size_type n = _data.size();
+            const T *data = n == 0 ? NULL : &_data[0];
+            size_type slot = 1;
+            while (slot <= n)
+            {
+                if (slot * prefetch_stride() <= n)
+                    FT_PREFETCH(data + slot * prefetch_stride() - 1);
+                slot = 2 * slot + (_compare(KeyOfValue()(data[slot - 1]), k) ? 1 : 0);
+            }
+            // The answer is the last slot where the descent went left: drop
+            // the trailing right turns (1 bits) and that left turn.
+            while (slot & 1)
+                slot >>= 1;
+            return slot >> 1;
+        }
+
+        // In-order successor of a slot, 0 after the last one: the leftmost
+        // slot of its right subtree, else the nearest ancestor it is left of.
+        size_type next_slot(size_type slot) const
+        {
+            const size_type n = _data.size();
+            if (2 * slot + 1 <= n)
+            {
+                slot = 2 * slot + 1;
+                while (2 * slot <= n)
+                    slot *= 2;
+                return slot;
+            }
+            while (slot & 1)
+                slot >>= 1;
+            return slot >> 1;
+        }
+
+        // Slot k * stride starts the descendants of slot k four levels
+        // down (a 64-byte line's worth of them for 4-byte keys).
+        static size_type prefetch_stride()
+        {
+            return 16;
+        }
+
+        // In-order walk of the implicit tree, taking the values in order.
+        template <typename ForwardIterator>
+        static void fill(ft::vector<const T *> &slots, ForwardIterator &it, size_type slot)
+        {
+            if (slot > slots.size())
+                return;
+            fill(slots, it, 2 * slot);
+            slots[slot - 1] = &*it;
+            ++it;
+            fill(slots, it, 2 * slot + 1);
+        }
+    };
+
+}
+
+#endif
@@ -0,0 +1,606 @@
+#ifndef HASH_TABLE_HPP
+#define HASH_TABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+#include "memory/allocator.hpp"
+
+#include "memory/uninitialized.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/pair.hpp"
+
+#include "util/type_traits.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+# define FT_HASH_TABLE_SSE2 1
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+
+    // One control byte per slot. A full slot stores the low 7 bits of its
+    // element's hash (0..127); the special values are all negative, so the
+    // sign bit alone tells free slots from full ones. The sentinel after
+    // the last slot stops iteration.
+    typedef signed char hash_ctrl;
+
+    const hash_ctrl hash_ctrl_empty = -128;
+    const hash_ctrl hash_ctrl_deleted = -2;
+    const hash_ctrl hash_ctrl_sentinel = -1;
+
+    inline unsigned int __hash_lowest_bit(unsigned int mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(mask);
+#else
+        unsigned int bit = 0;
+        while ((mask & 1u) == 0)
+        {
+            mask >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    /**
+     * @brief The 16 control bytes of one probe group, matched at once: each
+     * query returns a bit mask with bit i set when slot i of the group
+     * qualifies. One SSE2 compare and movemask on x86, a byte loop
+     * elsewhere.
+     */
+    class hash_group
+    {
+    public:
+        static const std::size_t width = 16;
+
+#ifdef FT_HASH_TABLE_SSE2
+        explicit hash_group(const hash_ctrl *ctrl) : _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+
+        unsigned int match(hash_ctrl h2) const
+        {
+            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(h2))));
+        }
+
+        /// Empty or deleted slots: exactly the ones with the sign bit set.
+        unsigned int match_free() const { return static_cast<unsigned int>(_mm_movemask_epi8(_ctrl)); }
+
+    private:
+        __m128i _ctrl;
+#else
+        explicit hash_group(const hash_ctrl *ctrl) : _ctrl(ctrl) {}
+
+        unsigned int match(hash_ctrl h2) const
+        {
+            unsigned int mask = 0;
+            for (std::size_t i = 0; i < width; ++i)
+                mask |= static_cast<unsigned int>(_ctrl[i] == h2) << i;
+            return mask;
+        }
+
+        unsigned int match_free() const
+        {
+            unsigned int mask = 0;
+            for (std::size_t i = 0; i < width; ++i)
+                mask |= static_cast<unsigned int>(_ctrl[i] < 0) << i;
+            return mask;
+        }
+
+    private:
+        const hash_ctrl *_ctrl;
+#endif
+
+    public:
+        unsigned int match_empty() const { return match(hash_ctrl_empty); }
+    };
+
+    // Control bytes of every table without slots: a lone sentinel, so that
+    // begin() == end() without a special case. Never written to.
+    inline hash_ctrl *__hash_empty_ctrl()
+    {
+        static hash_ctrl sentinel = hash_ctrl_sentinel;
+        return &sentinel;
+    }
+
+    template <typename T>
+    class hash_table_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+        hash_table_iterator() : _ctrl(NULL), _slot(NULL) {}
+
+        hash_table_iterator(const hash_ctrl *ctrl, T *slot) : _ctrl(ctrl), _slot(slot) { skip_free(); }
+
+        reference operator*() const { return *_slot; }
+
+        pointer operator->() const { return _slot; }
+
+        hash_table_iterator &operator++()
+        {
+            ++_ctrl;
+            ++_slot;
+            skip_free();
+            return *this;
+        }
+
+        hash_table_iterator operator++(int)
+        {
+            hash_table_iterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const hash_table_iterator &other) const { return _ctrl == other._ctrl; }
+
+        bool operator!=(const hash_table_iterator &other) const { return _ctrl != other._ctrl; }
+
+        const hash_ctrl *ctrl() const { return _ctrl; }
+
+        T *slot() const { return _slot; }
+
+    private:
+        const hash_ctrl *_ctrl;
+        T *_slot;
+
+        // Empty and deleted compare below the sentinel, full slots above.
+        void skip_free()
+        {
+            while (*_ctrl < hash_ctrl_sentinel)
+            {
+                ++_ctrl;
+                ++_slot;
+            }
+        }
+    };
+
+    template <typename T>
+    class hash_table_const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        hash_table_const_iterator() : _it() {}
+
+        hash_table_const_iterator(const hash_ctrl *ctrl, const T *slot) : _it(ctrl, const_cast<T *>(slot)) {}
+
+        hash_table_const_iterator(const hash_table_iterator<T> &other) : _it(other) {}
+
+        reference operator*() const { return *_it; }
+
+        pointer operator->() const { return _it.operator->(); }
+
+        hash_table_const_iterator &operator++()
+        {
+            ++_it;
+            return *this;
+        }
+
+        hash_table_const_iterator operator++(int)
+        {
+            hash_table_const_iterator tmp(*this);
+            ++_it;
+            return tmp;
+        }
+
+        bool operator==(const hash_table_const_iterator &other) const { return _it == other._it; }
+
+        bool operator!=(const hash_table_const_iterator &other) const { return _it != other._it; }
+
+        const hash_ctrl *ctrl() const { return _it.ctrl(); }
+
+        const T *slot() const { return _it.slot(); }
+
+    private:
+        hash_table_iterator<T> _it;
+    };
+
+    /**
+     * @brief Open-addressing hash table with unique keys, in the layout of
+     * Google's Swiss tables: the elements live in one flat slot array, and a
+     * separate array of one-byte control words (7 bits of hash, or empty /
+     * deleted) is scanned 16 slots at a time. A lookup hashes once, jumps to
+     * a group, and compares the key only in the slots whose control byte
+     * matches, so a miss usually costs one 16-byte compare and no key
+     * comparison at all.
+     *
+     * Groups are probed triangularly (g, g + 1, g + 3, ...), which visits
+     * every group of a power-of-two table. The table grows at 7/8 load.
+     * Erasing leaves a tombstone only when the slot's group is completely
+     * full, since a probe can only have passed through a full group. Erase
+     * and lookups never move elements, but any insertion may rehash and
+     * invalidate every iterator, pointer and reference.
+     */
+    template <typename T, typename Hash, typename KeyEqual, typename Alloc = ft::allocator<T>,
+              typename KeyOfValue = ft::identity<T> >
+    class hash_table
+    {
+    public:
+        typedef T value_type;
+        typedef typename ft::remove_const<typename KeyOfValue::result_type>::type key_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+        typedef Alloc allocator_type;
+        typedef std::size_t size_type;
+        typedef hash_table_iterator<T> iterator;
+        typedef hash_table_const_iterator<T> const_iterator;
+
+    private:
+        typedef typename Alloc::template rebind<hash_ctrl>::other ctrl_allocator_type;
+
+        static const size_type npos = static_cast<size_type>(-1);
+
+        hash_ctrl *_ctrl;
+        T *_slots;
+        size_type _capacity;
+        size_type _size;
+        size_type _growth_left;
+        Hash _hash;
+        KeyEqual _equal;
+        allocator_type _allocator;
+
+    public:
+        // Return type R of the lookups taking an arbitrary key type K, only
+        // available when both the hasher and the key equality are
+        // transparent.
+        template <typename K, typename R>
+        struct if_transparent : public ft::enable_if<ft::has_is_transparent<Hash, K>::value && ft::has_is_transparent<KeyEqual, K>::value, R>
+        {
+        };
+
+        explicit hash_table(size_type n = 0, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual(),
+                            const allocator_type &alloc = allocator_type())
+            : _ctrl(__hash_empty_ctrl()), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+              _hash(hash), _equal(equal), _allocator(alloc)
+        {
+            reserve(n);
+        }
+
+        hash_table(const hash_table &other)
+            : _ctrl(__hash_empty_ctrl()), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+              _hash(other._hash), _equal(other._equal), _allocator(other._allocator)
+        {
+            reserve(other._size);
+            try
+            {
+                for (const_iterator it = other.begin(); it != other.end(); ++it)
+                    insert_new(*it, _hash(KeyOfValue()(*it)));
+            }
+            catch (...)
+            {
+                deallocate();
+                throw;
+            }
+        }
+
+        ~hash_table()
+        {
+            deallocate();
+        }
+
+        hash_table &operator=(const hash_table &other)
+        {
+            if (this != &other)
+            {
+                hash_table tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        iterator begin() { return iterator(_ctrl, _slots); }
+
+        const_iterator begin() const { return const_iterator(_ctrl, _slots); }
+
+        iterator end() { return iterator(_ctrl + _capacity, _slots + _capacity); }
+
+        const_iterator end() const { return const_iterator(_ctrl + _capacity, _slots + _capacity); }
+
+        bool empty() const { return _size == 0; }
+
+        size_type size() const { return _size; }
+
+        size_type max_size() const { return _allocator.max_size(); }
+
+        /// Number of slots; every slot is its own "bucket".
+        size_type bucket_count() const { return _capacity; }
+
+        float load_factor() const { return _capacity == 0 ? 0.0f : static_cast<float>(_size) / static_cast<float>(_capacity); }
+
+        float max_load_factor() const { return 0.875f; }
+
+        hasher hash_function() const { return _hash; }
+
+        key_equal key_eq() const { return _equal; }
+
+        allocator_type get_allocator() const { return _allocator; }
+
+        /// Makes room for @c n elements without any further rehash.
+        void reserve(size_type n)
+        {
+            if (n > max_load(_capacity))
+                rehash_to(capacity_for(n));
+        }
+
+        /// Rebuilds with at least @c n slots, dropping every tombstone;
+        /// rehash(0) shrinks the table to fit its size.
+        void rehash(size_type n)
+        {
+            size_type capacity = capacity_for(_size);
+            while (capacity < n)
+                capacity *= 2;
+            if (capacity != _capacity || _size + _growth_left != max_load(_capacity))
+                rehash_to(capacity);
+        }
+
+        ft::pair<iterator, bool> insert_unique(const T &value)
+        {
+            const key_type &k = KeyOfValue()(value);
+            const size_type hash = _hash(k);
+            const size_type index = find_index(k, hash);
+            if (index != npos)
+                return ft::make_pair(iterator_at(index), false);
+            return ft::make_pair(iterator_at(insert_new(value, hash)), true);
+        }
+
+        template <typename InputIterator>
+        void insert_unique(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+                insert_unique(*first);
+        }
+
+        iterator erase(const_iterator position)
+        {
+            const size_type index = position.ctrl() - _ctrl;
+            erase_at(index);
+            return iterator(_ctrl + index + 1, _slots + index + 1);
+        }
+
+        // Exact match for iterators, which the transparent erase(const K &)
+        // below would otherwise win over erase(const_iterator).
+        iterator erase(iterator position) { return erase(const_iterator(position)); }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+            return iterator(last.ctrl(), const_cast<T *>(last.slot()));
+        }
+
+        size_type erase(const key_type &k)
+        {
+            const size_type index = find_index(k, _hash(k));
+            if (index == npos)
+                return 0;
+            erase_at(index);
+            return 1;
+        }
+
+        template <typename K>
+        typename if_transparent<K, size_type>::type erase(const K &k)
+        {
+            const size_type index = find_index(k, _hash(k));
+            if (index == npos)
+                return 0;
+            erase_at(index);
+            return 1;
+        }
+
+        /// Destroys every element but keeps the slots.
+        void clear()
+        {
+            if (_capacity == 0)
+                return;
+            destroy_all();
+            std::memset(_ctrl, hash_ctrl_empty, _capacity);
+            _size = 0;
+            _growth_left = max_load(_capacity);
+        }
+
+        void swap(hash_table &other)
+        {
+            std::swap(_ctrl, other._ctrl);
+            std::swap(_slots, other._slots);
+            std::swap(_capacity, other._capacity);
+            std::swap(_size, other._size);
+            std::swap(_growth_left, other._growth_left);
+            std::swap(_hash, other._hash);
+            std::swap(_equal, other._equal);
+            std::swap(_allocator, other._allocator);
+        }
+
+        iterator find(const key_type &k) { return iterator_at(find_index(k, _hash(k))); }
+
+        const_iterator find(const key_type &k) const { return const_iterator_at(find_index(k, _hash(k))); }
+
+        template <typename K>
+        typename if_transparent<K, iterator>::type find(const K &k) { return iterator_at(find_index(k, _hash(k))); }
+
+        template <typename K>
+        typename if_transparent<K, const_iterator>::type find(const K &k) const
+        {
+            return const_iterator_at(find_index(k, _hash(k)));
+        }
+
+        size_type count(const key_type &k) const { return find_index(k, _hash(k)) != npos; }
+
+        template <typename K>
+        typename if_transparent<K, size_type>::type count(const K &k) const { return find_index(k, _hash(k)) != npos; }
+
+    private:
+        static size_type max_load(size_type capacity) { return capacity - capacity / 8; }
+
+        // Smallest power-of-two number of groups holding n elements.
+        static size_type capacity_for(size_type n)
+        {
+            size_type capacity = hash_group::width;
+            while (max_load(capacity) < n)
+                capacity *= 2;
+            return capacity;
+        }
+
+        static hash_ctrl h2(size_type hash) { return static_cast<hash_ctrl>(hash & 0x7F); }
+
+        iterator iterator_at(size_type index)
+        {
+            return index == npos ? end() : iterator(_ctrl + index, _slots + index);
+        }
+
+        const_iterator const_iterator_at(size_type index) const
+        {
+            return index == npos ? end() : const_iterator(_ctrl + index, _slots + index);
+        }
+
+        template <typename K>
+        size_type find_index(const K &k, size_type hash) const
+        {
+            if (_capacity == 0)
+                return npos;
+            const size_type mask = _capacity / hash_group::width - 1;
+            size_type group = (hash >> 7) & mask;
+            for (size_type step = 1;; ++step)
+            {
+                const size_type base = group * hash_group::width;
+                const hash_group g(_ctrl + base);
+                for (unsigned int match = g.match(h2(hash)); match != 0; match &= match - 1)
+                {
+                    const size_type index = base + __hash_lowest_bit(match);
+                    if (_equal(KeyOfValue()(_slots[index]), k))
+                        return index;
+                }
+                if (g.match_empty() != 0)
+                    return npos;
+                group = (group + step) & mask;
+            }
+        }
+
+        // First empty or deleted slot on the probe sequence of @c hash.
+        size_type find_free(size_type hash) const
+        {
+            const size_type mask = _capacity / hash_group::width - 1;
+            size_type group = (hash >> 7) & mask;
+            for (size_type step = 1;; ++step)
+            {
+                const unsigned int free = hash_group(_ctrl + group * hash_group::width).match_free();
+                if (free != 0)
+                    return group * hash_group::width + __hash_lowest_bit(free);
+                group = (group + step) & mask;
+            }
+        }
+
+        // Inserts a value whose key is known to be absent. A tombstone on
+        // the probe path is reused for free; taking an empty slot needs
+        // growth left, otherwise the table is rebuilt first: in place when
+        // tombstones are what fills it, twice as large otherwise.
+        size_type insert_new(const T &value, size_type hash)
+        {
+            size_type index = _capacity == 0 ? npos : find_free(hash);
+            if (_growth_left == 0 && (index == npos || _ctrl[index] != hash_ctrl_deleted))
+            {
+                if (_capacity == 0)
+                    rehash_to(hash_group::width);
+                else
+                    rehash_to(_size < max_load(_capacity) / 2 ? _capacity : _capacity * 2);
+                index = find_free(hash);
+            }
+            _allocator.construct(_slots + index, value);
+            if (_ctrl[index] == hash_ctrl_empty)
+                --_growth_left;
+            _ctrl[index] = h2(hash);
+            ++_size;
+            return index;
+        }
+
+        void erase_at(size_type index)
+        {
+            _allocator.destroy(_slots + index);
+            --_size;
+            const size_type base = index & ~(hash_group::width - 1);
+            if (hash_group(_ctrl + base).match_empty() != 0)
+            {
+                _ctrl[index] = hash_ctrl_empty;
+                ++_growth_left;
+            }
+            else
+                _ctrl[index] = hash_ctrl_deleted;
+        }
+
+        // Moves every element into fresh arrays of @c capacity slots. The
+        // old elements are destroyed only once all of them are in place, so
+        // a throwing copy leaves the table untouched.
+        void rehash_to(size_type capacity)
+        {
+            ctrl_allocator_type ctrl_allocator(_allocator);
+            hash_ctrl *ctrl = ctrl_allocator.allocate(capacity + 1);
+            T *slots;
+            try
+            {
+                slots = _allocator.allocate(capacity);
+            }
+            catch (...)
+            {
+                ctrl_allocator.deallocate(ctrl, capacity + 1);
+                throw;
+            }
+            std::memset(ctrl, hash_ctrl_empty, capacity);
+            ctrl[capacity] = hash_ctrl_sentinel;
+
+            hash_table fresh(_hash, _equal, _allocator, ctrl, slots, capacity);
+            for (iterator it = begin(); it != end(); ++it)
+            {
+                const size_type hash = _hash(KeyOfValue()(*it));
+                const size_type index = fresh.find_free(hash);
+                ::new (static_cast<void *>(fresh._slots + index)) T(FT_RELOCATION_SOURCE(*it));
+                fresh._ctrl[index] = h2(hash);
+                ++fresh._size;
+            }
+            fresh._growth_left = max_load(capacity) - fresh._size;
+            swap(fresh);
+        }
+
+        // Adopts freshly allocated, all-empty arrays.
+        hash_table(const Hash &hash, const KeyEqual &equal, const allocator_type &alloc, hash_ctrl *ctrl, T *slots, size_type capacity)
+            : _ctrl(ctrl), _slots(slots), _capacity(capacity), _size(0), _growth_left(0),
+              _hash(hash), _equal(equal), _allocator(alloc)
+        {
+        }
+
+        void destroy_all()
+        {
+            for (iterator it = begin(); it != end(); ++it)
+                _allocator.destroy(it.slot());
+        }
+
+        void deallocate()
+        {
+            if (_capacity == 0)
+                return;
+            destroy_all();
+            ctrl_allocator_type(_allocator).deallocate(_ctrl, _capacity + 1);
+            _allocator.deallocate(_slots, _capacity);
+            _ctrl = __hash_empty_ctrl();
+            _slots = NULL;
+            _capacity = 0;
+            _size = 0;
+            _growth_left = 0;
+        }
+    };
+
+}
+
+#endif
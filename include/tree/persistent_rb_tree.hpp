@@ -0,0 +1,643 @@
+#ifndef PERSISTENT_RB_TREE_HPP
+#define PERSISTENT_RB_TREE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+
+#include "container/vector.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/type_traits.hpp"
+
+namespace ft
+{
+
+    /**
+     * @brief Immutable red-black tree node shared between versions of a
+     * persistent_rb_tree. @c refs counts the parents and snapshots holding
+     * it; the last release frees the node and releases its children.
+     */
+    template <typename T>
+    struct persistent_rb_node
+    {
+        T value;
+        persistent_rb_node *left;
+        persistent_rb_node *right;
+        int refs;
+        bool red;
+    };
+
+    /**
+     * @brief Persistent (path-copying) red-black tree of unique keys for one
+     * writer and any number of concurrent readers.
+     *
+     * Nodes are never modified once published: insert and remove copy the
+     * O(log n) nodes on the search path, rebalancing with Kahrs' functional
+     * insertion and deletion, and share every other subtree with the
+     * previous version. The new root is then published with a single
+     * pointer store. Readers call snapshot() to take a reference to the
+     * current root in O(1) without any lock: they only announce themselves
+     * in the counter of the current epoch while they retain it, and a writer
+     * releases the root it replaced once the readers of the previous epoch
+     * are gone. Readers thus never wait for a writer, search their snapshot
+     * without further synchronisation and see a consistent version for as
+     * long as they keep it.
+     *
+     * Old versions are reclaimed by atomic reference counts on the nodes:
+     * whichever thread drops the last reference to a node (the writer or a
+     * reader destroying its snapshot) frees it, so Alloc must be thread-safe
+     * (the default std::allocator is; ft::pool_allocator is not). Writers
+     * are serialized among themselves.
+     */
+    template <typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<T>,
+              typename KeyOfValue = ft::identity<T> >
+    class persistent_rb_tree
+    {
+    public:
+        typedef T value_type;
+        typedef typename ft::remove_const<typename KeyOfValue::result_type>::type key_type;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+        typedef size_t size_type;
+
+    private:
+        typedef persistent_rb_node<T> node;
+        typedef typename Alloc::template rebind<node>::other node_allocator_type;
+
+    public:
+        /// One immutable version of the tree, as returned by snapshot(); cheap
+        /// to copy.
+        class version
+        {
+        public:
+            // In-order walk keeping the path to the current node, since
+            // shared nodes cannot point back to a single parent.
+            class const_iterator
+            {
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef T value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const T *pointer;
+                typedef const T &reference;
+
+                const_iterator() : _path() {}
+
+                reference operator*() const { return _path.back()->value; }
+
+                pointer operator->() const { return &_path.back()->value; }
+
+                const_iterator &operator++()
+                {
+                    const node *n = _path.back();
+                    if (n->right != NULL)
+                    {
+                        descend_left(n->right);
+                        return *this;
+                    }
+                    _path.pop_back();
+                    while (!_path.empty() && _path.back()->right == n)
+                    {
+                        n = _path.back();
+                        _path.pop_back();
+                    }
+                    return *this;
+                }
+
+                const_iterator operator++(int)
+                {
+                    const_iterator tmp(*this);
+                    ++*this;
+                    return tmp;
+                }
+
+                bool operator==(const const_iterator &other) const
+                {
+                    return _path.empty() ? other._path.empty() : !other._path.empty() && _path.back() == other._path.back();
+                }
+
+                bool operator!=(const const_iterator &other) const { return !(*this == other); }
+
+            private:
+                friend class version;
+
+                void descend_left(const node *n)
+                {
+                    for (; n != NULL; n = n->left)
+                        _path.push_back(n);
+                }
+
+                ft::vector<const node *> _path;
+            };
+
+            version() : _root(NULL), _size(0), _compare(), _allocator() {}
+
+            version(const version &other)
+                : _root(retain(other._root)), _size(other._size), _compare(other._compare), _allocator(other._allocator) {}
+
+            version &operator=(const version &other)
+            {
+                node *root = retain(other._root);
+                release(_allocator, _root);
+                _root = root;
+                _size = other._size;
+                _compare = other._compare;
+                _allocator = other._allocator;
+                return *this;
+            }
+
+            ~version() { release(_allocator, _root); }
+
+            bool empty() const { return _size == 0; }
+
+            size_type size() const { return _size; }
+
+            /// Element with a key equivalent to @c k, or NULL.
+            const T *find(const key_type &k) const
+            {
+                const node *n = _root;
+                while (n != NULL)
+                {
+                    if (_compare(k, KeyOfValue()(n->value)))
+                        n = n->left;
+                    else if (_compare(KeyOfValue()(n->value), k))
+                        n = n->right;
+                    else
+                        return &n->value;
+                }
+                return NULL;
+            }
+
+            size_type count(const key_type &k) const { return find(k) != NULL ? 1 : 0; }
+
+            /// First element whose key is not less than @c k, or NULL.
+            const T *lower_bound(const key_type &k) const
+            {
+                const node *n = _root;
+                const node *bound = NULL;
+                while (n != NULL)
+                {
+                    if (_compare(KeyOfValue()(n->value), k))
+                        n = n->right;
+                    else
+                    {
+                        bound = n;
+                        n = n->left;
+                    }
+                }
+                return bound != NULL ? &bound->value : NULL;
+            }
+
+            /// Nodes on the longest root-to-leaf path.
+            size_type height() const { return height(_root); }
+
+            const_iterator begin() const
+            {
+                const_iterator it;
+                it.descend_left(_root);
+                return it;
+            }
+
+            const_iterator end() const { return const_iterator(); }
+
+        private:
+            friend class persistent_rb_tree;
+
+            // Adopts a reference to root.
+            version(node *root, size_type size, const Compare &compare, const node_allocator_type &allocator)
+                : _root(root), _size(size), _compare(compare), _allocator(allocator) {}
+
+            static size_type height(const node *n)
+            {
+                if (n == NULL)
+                    return 0;
+                const size_type left = height(n->left);
+                const size_type right = height(n->right);
+                return 1 + (left > right ? left : right);
+            }
+
+            node *_root;
+            size_type _size;
+            Compare _compare;
+            node_allocator_type _allocator;
+        };
+
+    private:
+        // The published root and size. The writer fills the slot readers are
+        // not using and publishes it by swapping _current.
+        struct published
+        {
+            node *root;
+            size_type size;
+        };
+
+        published _slots[2];
+        published *_current;
+        Compare _compare;
+        node_allocator_type _allocator;
+        // Readers inside snapshot(), counted by the parity of _epoch.
+        mutable int _readers[2];
+        unsigned int _epoch;
+        int _write_lock;
+
+    public:
+        explicit persistent_rb_tree(const Compare &compare = Compare(), const allocator_type &alloc = allocator_type())
+            : _current(_slots), _compare(compare), _allocator(alloc), _epoch(0), _write_lock(0)
+        {
+            _slots[0].root = NULL;
+            _slots[0].size = 0;
+            _readers[0] = _readers[1] = 0;
+        }
+
+        // O(1): the copy shares every node with other's current version.
+        persistent_rb_tree(const persistent_rb_tree &other)
+            : _current(_slots), _compare(other._compare), _allocator(other._allocator), _epoch(0), _write_lock(0)
+        {
+            version current = other.snapshot();
+            _slots[0].root = retain(current._root);
+            _slots[0].size = current._size;
+            _readers[0] = _readers[1] = 0;
+        }
+
+        ~persistent_rb_tree() { release(_allocator, _current->root); }
+
+        /// The current version, in O(1) and lock-free; readers may call this
+        /// concurrently with a writer.
+        version snapshot() const
+        {
+            // Join the current epoch; retry if a writer moved on meanwhile,
+            // since it may not have seen this reader.
+            unsigned int epoch;
+            for (;;)
+            {
+                epoch = __atomic_load_n(&_epoch, __ATOMIC_SEQ_CST);
+                __atomic_add_fetch(&_readers[epoch & 1], 1, __ATOMIC_SEQ_CST);
+                if (__atomic_load_n(&_epoch, __ATOMIC_SEQ_CST) == epoch)
+                    break;
+                __atomic_sub_fetch(&_readers[epoch & 1], 1, __ATOMIC_RELEASE);
+            }
+            const published *current = __atomic_load_n(&_current, __ATOMIC_SEQ_CST);
+            node *root = retain(current->root);
+            const size_type size = current->size;
+            __atomic_sub_fetch(&_readers[epoch & 1], 1, __ATOMIC_RELEASE);
+            return version(root, size, _compare, _allocator);
+        }
+
+        size_type size() const { return snapshot().size(); }
+
+        bool empty() const { return size() == 0; }
+
+        /// Inserts @c value unless its key is present; returns whether it did.
+        bool insert(const T &value)
+        {
+            lock(_write_lock);
+            try
+            {
+                const key_type &k = KeyOfValue()(value);
+                if (contains(k))
+                {
+                    unlock(_write_lock);
+                    return false;
+                }
+                publish(blacken(insert(_current->root, value)), _current->size + 1);
+            }
+            catch (...)
+            {
+                unlock(_write_lock);
+                throw;
+            }
+            unlock(_write_lock);
+            return true;
+        }
+
+        size_type remove(const key_type &k)
+        {
+            lock(_write_lock);
+            try
+            {
+                if (!contains(k))
+                {
+                    unlock(_write_lock);
+                    return 0;
+                }
+                publish(blacken(remove(_current->root, k)), _current->size - 1);
+            }
+            catch (...)
+            {
+                unlock(_write_lock);
+                throw;
+            }
+            unlock(_write_lock);
+            return 1;
+        }
+
+        allocator_type get_allocator() const { return allocator_type(_allocator); }
+
+    private:
+        persistent_rb_tree &operator=(const persistent_rb_tree &);
+
+        static void lock(int &flag)
+        {
+            while (__atomic_exchange_n(&flag, 1, __ATOMIC_ACQUIRE) != 0)
+                while (__atomic_load_n(&flag, __ATOMIC_RELAXED) != 0)
+                    ;
+        }
+
+        static void unlock(int &flag)
+        {
+            __atomic_store_n(&flag, 0, __ATOMIC_RELEASE);
+        }
+
+        // Only writers change _current, so the writer reads it without
+        // synchronisation.
+        bool contains(const key_type &k) const
+        {
+            const node *n = _current->root;
+            while (n != NULL)
+            {
+                if (_compare(k, KeyOfValue()(n->value)))
+                    n = n->left;
+                else if (_compare(KeyOfValue()(n->value), k))
+                    n = n->right;
+                else
+                    return true;
+            }
+            return false;
+        }
+
+        // The spare slot is free: the previous publish waited out every
+        // reader that could still see it.
+        void publish(node *root, size_type size)
+        {
+            published *old = _current;
+            published *next = old == _slots ? _slots + 1 : _slots;
+            next->root = root;
+            next->size = size;
+            __atomic_store_n(&_current, next, __ATOMIC_SEQ_CST);
+
+            // Readers that joined the old epoch may still be retaining
+            // old->root; later ones see the new epoch and the new slot.
+            const unsigned int epoch = _epoch;
+            __atomic_store_n(&_epoch, epoch + 1, __ATOMIC_SEQ_CST);
+            while (__atomic_load_n(&_readers[epoch & 1], __ATOMIC_ACQUIRE) != 0)
+                ;
+            release(_allocator, old->root);
+        }
+
+        // Reference counting. Functions below take ownership of the node
+        // pointers they are passed and return an owned pointer; a node whose
+        // count is 1 is reachable only from the version being built and may
+        // be recoloured in place.
+
+        static node *retain(const node *n)
+        {
+            if (n != NULL)
+                __atomic_add_fetch(&const_cast<node *>(n)->refs, 1, __ATOMIC_RELAXED);
+            return const_cast<node *>(n);
+        }
+
+        static void release(node_allocator_type &allocator, node *n)
+        {
+            while (n != NULL && __atomic_sub_fetch(&n->refs, 1, __ATOMIC_ACQ_REL) == 0)
+            {
+                node *right = n->right;
+                release(allocator, n->left);
+                n->value.~T();
+                allocator.deallocate(n, 1);
+                n = right;
+            }
+        }
+
+        void release(node *n) { release(_allocator, n); }
+
+        // Holds one owned reference while a rebalancing step builds nodes
+        // and releases it when the step ends, whether it returns or throws.
+        // take() hands the reference on instead.
+        class owned
+        {
+        public:
+            owned(node_allocator_type &allocator, node *n) : _allocator(allocator), _node(n) {}
+
+            ~owned() { release(_allocator, _node); }
+
+            node *get() const { return _node; }
+
+            node *take()
+            {
+                node *n = _node;
+                _node = NULL;
+                return n;
+            }
+
+        private:
+            owned(const owned &);
+
+            owned &operator=(const owned &);
+
+            node_allocator_type &_allocator;
+
+            node *_node;
+        };
+
+        // On failure the child references are released, so a write that
+        // throws part way frees every node it built and leaves the published
+        // version untouched. Arguments that may throw are therefore evaluated
+        // before make() or balance() is called, never beside an owned one.
+        node *make(bool red, node *left, const T &value, node *right)
+        {
+            node *n = NULL;
+            try
+            {
+                n = _allocator.allocate(1);
+                ::new (static_cast<void *>(&n->value)) T(value);
+            }
+            catch (...)
+            {
+                if (n != NULL)
+                    _allocator.deallocate(n, 1);
+                release(left);
+                release(right);
+                throw;
+            }
+            n->left = left;
+            n->right = right;
+            n->refs = 1;
+            n->red = red;
+            return n;
+        }
+
+        static bool is_red(const node *n) { return n != NULL && n->red; }
+
+        static bool is_black(const node *n) { return n != NULL && !n->red; }
+
+        node *paint(node *n, bool red)
+        {
+            if (n->red == red)
+                return n;
+            if (__atomic_load_n(&n->refs, __ATOMIC_RELAXED) == 1)
+            {
+                n->red = red;
+                return n;
+            }
+            owned old(_allocator, n);
+            return make(red, retain(n->left), n->value, retain(n->right));
+        }
+
+        node *blacken(node *n) { return n == NULL ? NULL : paint(n, false); }
+
+        // Kahrs' balance: a black node over (a, b) that may have a red-red
+        // violation on one side.
+        node *balance(node *a, const T &x, node *b)
+        {
+            owned held_a(_allocator, a);
+            owned held_b(_allocator, b);
+            if (is_red(a) && is_red(b))
+            {
+                owned left(_allocator, paint(held_a.take(), false));
+                node *right = paint(held_b.take(), false);
+                return make(true, left.take(), x, right);
+            }
+            if (is_red(a) && is_red(a->left))
+            {
+                owned left(_allocator, paint(retain(a->left), false));
+                node *right = make(false, retain(a->right), x, held_b.take());
+                return make(true, left.take(), a->value, right);
+            }
+            if (is_red(a) && is_red(a->right))
+            {
+                owned left(_allocator, make(false, retain(a->left), a->value, retain(a->right->left)));
+                node *right = make(false, retain(a->right->right), x, held_b.take());
+                return make(true, left.take(), a->right->value, right);
+            }
+            if (is_red(b) && is_red(b->right))
+            {
+                owned left(_allocator, make(false, held_a.take(), x, retain(b->left)));
+                node *right = paint(retain(b->right), false);
+                return make(true, left.take(), b->value, right);
+            }
+            if (is_red(b) && is_red(b->left))
+            {
+                owned left(_allocator, make(false, held_a.take(), x, retain(b->left->left)));
+                node *right = make(false, retain(b->left->right), b->value, retain(b->right));
+                return make(true, left.take(), b->left->value, right);
+            }
+            return make(false, held_a.take(), x, held_b.take());
+        }
+
+        node *insert(const node *n, const T &value)
+        {
+            if (n == NULL)
+                return make(true, NULL, value, NULL);
+            const bool left = _compare(KeyOfValue()(value), KeyOfValue()(n->value));
+            node *child = insert(left ? n->left : n->right, value);
+            if (n->red)
+                return left ? make(true, child, n->value, retain(n->right))
+                            : make(true, retain(n->left), n->value, child);
+            return left ? balance(child, n->value, retain(n->right))
+                        : balance(retain(n->left), n->value, child);
+        }
+
+        // The left subtree lost one black level.
+        node *balance_left(node *left, const T &x, node *right)
+        {
+            owned held_left(_allocator, left);
+            owned held_right(_allocator, right);
+            if (is_red(left))
+            {
+                node *painted = paint(held_left.take(), false);
+                return make(true, painted, x, held_right.take());
+            }
+            if (is_black(right))
+            {
+                node *painted = paint(held_right.take(), true);
+                return balance(held_left.take(), x, painted);
+            }
+            // right is red with a black left child.
+            owned new_left(_allocator, make(false, held_left.take(), x, retain(right->left->left)));
+            node *painted = paint(retain(right->right), true);
+            node *new_right = balance(retain(right->left->right), right->value, painted);
+            return make(true, new_left.take(), right->left->value, new_right);
+        }
+
+        // The right subtree lost one black level.
+        node *balance_right(node *left, const T &x, node *right)
+        {
+            owned held_left(_allocator, left);
+            owned held_right(_allocator, right);
+            if (is_red(right))
+            {
+                node *painted = paint(held_right.take(), false);
+                return make(true, held_left.take(), x, painted);
+            }
+            if (is_black(left))
+            {
+                node *painted = paint(held_left.take(), true);
+                return balance(painted, x, held_right.take());
+            }
+            // left is red with a black right child.
+            node *painted = paint(retain(left->left), true);
+            owned new_left(_allocator, balance(painted, left->value, retain(left->right->left)));
+            node *new_right = make(false, retain(left->right->right), x, held_right.take());
+            return make(true, new_left.take(), left->right->value, new_right);
+        }
+
+        // Joins the two subtrees of a removed node.
+        node *append(node *a, node *b)
+        {
+            if (a == NULL)
+                return b;
+            if (b == NULL)
+                return a;
+            owned held_a(_allocator, a);
+            owned held_b(_allocator, b);
+            if (a->red == b->red)
+            {
+                owned middle(_allocator, append(retain(a->right), retain(b->left)));
+                const node *m = middle.get();
+                if (is_red(m))
+                {
+                    owned left(_allocator, make(a->red, retain(a->left), a->value, retain(m->left)));
+                    node *right = make(a->red, retain(m->right), b->value, retain(b->right));
+                    return make(true, left.take(), m->value, right);
+                }
+                node *right = make(a->red, middle.take(), b->value, retain(b->right));
+                if (a->red)
+                    return make(true, retain(a->left), a->value, right);
+                return balance_left(retain(a->left), a->value, right);
+            }
+            if (b->red)
+            {
+                node *left = append(held_a.take(), retain(b->left));
+                return make(true, left, b->value, retain(b->right));
+            }
+            node *right = append(retain(a->right), held_b.take());
+            return make(true, retain(a->left), a->value, right);
+        }
+
+        // Kahrs' deletion; the key must be present.
+        node *remove(const node *n, const key_type &k)
+        {
+            if (_compare(k, KeyOfValue()(n->value)))
+            {
+                node *child = remove(n->left, k);
+                if (is_black(n->left))
+                    return balance_left(child, n->value, retain(n->right));
+                return make(true, child, n->value, retain(n->right));
+            }
+            if (_compare(KeyOfValue()(n->value), k))
+            {
+                node *child = remove(n->right, k);
+                if (is_black(n->right))
+                    return balance_right(retain(n->left), n->value, child);
+                return make(true, retain(n->left), n->value, child);
+            }
+            return append(retain(n->left), retain(n->right));
+        }
+    };
+
+}
+
+#endif
@@ -1,10 +1,21 @@
 #ifndef RB_TREE_HPP
 #define RB_TREE_HPP
 
+#include <cstddef>
 #include <iterator>
 #include <functional>
 #include <memory>
 
+#include "memory/pool_allocator.hpp"
+
+#include "tree/frozen_index.hpp"
+
+#include "util/functional.hpp"
+
+#include "util/pair.hpp"
+
+#include "util/type_traits.hpp"
+
 namespace ft
 {
     enum rb_color
@@ -13,85 +24,179 @@ namespace ft
         RB_BLACK = false
     };
 
-    template <typename T>
-    struct rb_node
+    struct rb_node_base
     {
-        rb_node *parent;
-        rb_node *left;
-        rb_node *right;
-        rb_color color;
-        T value;
+    private:
+#ifdef FT_RB_TREE_WIDE_NODES
+        rb_node_base *_parent;
+#else
+        // The parent pointer with the colour in its low bit, which is always
+        // clear in the address of a node: 24 bytes of links on 64-bit
+        // instead of 32 with a separate (padded) colour field.
+        std::size_t _parent_and_color;
+#endif
+
+    public:
+        rb_node_base *left;
+        rb_node_base *right;
+
+    private:
+#ifdef FT_RB_TREE_WIDE_NODES
+        rb_color _color;
+#endif
 
-        rb_node() : parent(), left(), right(), color(RB_RED), value() {}
+    public:
+#ifdef FT_RB_TREE_WIDE_NODES
+        rb_node_base() : _parent(), left(), right(), _color(RB_RED) {}
 
-        rb_node(const T &value) : parent(), left(), right(), color(RB_RED), value(value) {}
+        rb_node_base *parent() const { return _parent; }
 
-        rb_node(const rb_node &other) : parent(other.parent), left(other.left), right(other.right), color(other.color), value(other.value) {}
+        void set_parent(rb_node_base *parent) { _parent = parent; }
 
-        ~rb_node() {}
+        rb_color color() const { return _color; }
 
-        static rb_node<T> *leftmost(rb_node<T> *node)
+        void set_color(rb_color color) { _color = color; }
+#else
+        rb_node_base() : _parent_and_color(RB_RED), left(), right() {}
+
+        rb_node_base *parent() const
+        {
+            return reinterpret_cast<rb_node_base *>(_parent_and_color & ~static_cast<std::size_t>(1));
+        }
+
+        void set_parent(rb_node_base *parent)
+        {
+            _parent_and_color = reinterpret_cast<std::size_t>(parent) | (_parent_and_color & 1);
+        }
+
+        rb_color color() const { return (_parent_and_color & 1) ? RB_RED : RB_BLACK; }
+
+        void set_color(rb_color color)
+        {
+            _parent_and_color = (_parent_and_color & ~static_cast<std::size_t>(1)) | (color == RB_RED ? 1 : 0);
+        }
+#endif
+
+        static rb_node_base *leftmost(rb_node_base *node)
         {
-            if (node == NULL)
-                return NULL;
             while (node->left != NULL)
                 node = node->left;
             return node;
         }
 
-        static rb_node<T> *rightmost(rb_node<T> *node)
+        static rb_node_base *rightmost(rb_node_base *node)
         {
-            if (node == NULL)
-                return NULL;
             while (node->right != NULL)
                 node = node->right;
             return node;
         }
 
-        static rb_node<T> *successor(rb_node<T> *node)
+        // The tree keeps a header node whose parent is the root and whose
+        // left/right are the leftmost/rightmost nodes; the root's parent is
+        // the header. The header is the only red node whose grandparent is
+        // itself, which is how it is told apart from the root.
+        static bool is_header(const rb_node_base *node)
+        {
+            return node->color() == RB_RED && node->parent() != NULL && node->parent()->parent() == node;
+        }
+
+        static rb_node_base *successor(rb_node_base *node)
         {
-            if (node == NULL)
-                return NULL;
             if (node->right != NULL)
                 return leftmost(node->right);
-            rb_node<T> *parent = node->parent;
-            while (parent != NULL && node == parent->right)
+            rb_node_base *parent = node->parent();
+            while (node == parent->right)
             {
                 node = parent;
-                parent = parent->parent;
+                parent = parent->parent();
             }
-            return parent;
+            // When the root is the rightmost node the climb overshoots into
+            // the header and then back to the root: stop on the header.
+            if (node->right != parent)
+                node = parent;
+            return node;
         }
 
-        static rb_node<T> *predecessor(rb_node<T> *node)
+        static rb_node_base *predecessor(rb_node_base *node)
         {
+            if (is_header(node))
+                return node->right;
             if (node->left != NULL)
                 return rightmost(node->left);
-            rb_node<T> *parent = node->parent;
-            while (parent != NULL && node == parent->left)
+            rb_node_base *parent = node->parent();
+            while (node == parent->left)
             {
                 node = parent;
-                parent = parent->parent;
+                parent = parent->parent();
             }
             return parent;
         }
     };
 
+    template <typename T>
+    struct rb_node : public rb_node_base
+    {
+        T value;
+
+        rb_node() : rb_node_base(), value() {}
+
+        rb_node(const T &value) : rb_node_base(), value(value) {}
+
+        rb_node(const rb_node &other) : rb_node_base(other), value(other.value) {}
+
+        ~rb_node() {}
+
+        // Hooks rb_tree calls when the shape below a node changes. The plain
+        // node keeps no per-subtree data, so they compile away.
+        static const bool augmented = false;
+
+        static void update(rb_node_base *) {}
+    };
+
+    /**
+     * @brief Node augmented with the size of its subtree, for order
+     * statistics: an rb_tree using it (Node = rb_counted_node<T>) offers
+     * select(k), rank(key) and index_of / distance in O(log n), at the cost
+     * of one word per node and of refreshing the counts along the insertion
+     * or deletion path. The count follows the value so that iterators reach
+     * the value at the same offset as in a plain rb_node.
+     */
+    template <typename T>
+    struct rb_counted_node : public rb_node<T>
+    {
+        size_t count;
+
+        rb_counted_node() : rb_node<T>(), count(1) {}
+
+        rb_counted_node(const T &value) : rb_node<T>(value), count(1) {}
+
+        static const bool augmented = true;
+
+        static size_t subtree_size(const rb_node_base *node)
+        {
+            return node == NULL ? 0 : static_cast<const rb_counted_node *>(node)->count;
+        }
+
+        static void update(rb_node_base *node)
+        {
+            static_cast<rb_counted_node *>(node)->count = 1 + subtree_size(node->left) + subtree_size(node->right);
+        }
+    };
+
     template <typename T>
     class rb_iterator : public std::iterator<std::bidirectional_iterator_tag, T>
     {
     private:
-        rb_node<T> *node;
-        rb_node<T> *previous;
+        rb_node_base *node;
 
     public:
         ~rb_iterator() {}
 
-        rb_iterator() : node(), previous() {}
+        rb_iterator() : node() {}
 
-        rb_iterator(rb_node<T> *node) : node(node), previous() {}
+        rb_iterator(rb_node_base *node) : node(node) {}
 
-        rb_iterator(const rb_iterator &other) : node(other.node), previous(other.previous) {}
+        rb_iterator(const rb_iterator &other) : node(other.node) {}
 
         rb_iterator &operator=(const rb_iterator &other)
         {
@@ -101,23 +206,13 @@ namespace ft
 
         rb_iterator &operator++()
         {
-            if (node == NULL)
-            {
-                std::swap(node, previous);
-                return *this;
-            }
-            node = rb_node<T>::successor(node);
+            node = rb_node_base::successor(node);
             return *this;
         }
 
         rb_iterator &operator--()
         {
-            if (node == NULL)
-            {
-                std::swap(node, previous);
-                return *this;
-            }
-            node = rb_node<T>::predecessor(node);
+            node = rb_node_base::predecessor(node);
             return *this;
         }
 
@@ -139,26 +234,29 @@ namespace ft
 
         bool operator!=(const rb_iterator &other) const { return node != other.node; }
 
-        T &operator*() const { return node->value; }
+        T &operator*() const { return static_cast<rb_node<T> *>(node)->value; }
 
-        T *operator->() const { return &node->value; }
+        T *operator->() const { return &static_cast<rb_node<T> *>(node)->value; }
+
+        rb_node_base *base() const { return node; }
     };
 
     template <typename T>
-    class rb_const_iterator : public std::iterator<std::bidirectional_iterator_tag, T>
+    class rb_const_iterator : public std::iterator<std::bidirectional_iterator_tag, T, std::ptrdiff_t, const T *, const T &>
     {
     private:
-        rb_node<T> *node;
-        rb_node<T> *previous;
+        const rb_node_base *node;
 
     public:
         ~rb_const_iterator() {}
 
-        rb_const_iterator() : node(), previous() {}
+        rb_const_iterator() : node() {}
+
+        rb_const_iterator(const rb_node_base *node) : node(node) {}
 
-        rb_const_iterator(rb_node<T> *node) : node(node), previous() {}
+        rb_const_iterator(const rb_const_iterator &other) : node(other.node) {}
 
-        rb_const_iterator(const rb_const_iterator &other) : node(other.node), previous(other.previous) {}
+        rb_const_iterator(const rb_iterator<T> &other) : node(other.base()) {}
 
         rb_const_iterator &operator=(const rb_const_iterator &other)
         {
@@ -168,23 +266,13 @@ namespace ft
 
         rb_const_iterator &operator++()
         {
-            if (node == NULL)
-            {
-                std::swap(node, previous);
-                return *this;
-            }
-            node = rb_node<T>::successor(node);
+            node = rb_node_base::successor(const_cast<rb_node_base *>(node));
             return *this;
         }
 
         rb_const_iterator &operator--()
         {
-            if (node == NULL)
-            {
-                std::swap(node, previous);
-                return *this;
-            }
-            node = rb_node<T>::predecessor(node);
+            node = rb_node_base::predecessor(const_cast<rb_node_base *>(node));
             return *this;
         }
 
@@ -206,19 +294,37 @@ namespace ft
 
         bool operator!=(const rb_const_iterator &other) const { return node != other.node; }
 
-        const T &operator*() const { return node->value; }
+        const T &operator*() const { return static_cast<const rb_node<T> *>(node)->value; }
 
-        const T *operator->() const { return &node->value; }
+        const T *operator->() const { return &static_cast<const rb_node<T> *>(node)->value; }
+
+        const rb_node_base *base() const { return node; }
     };
 
-    template <typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<rb_node<T> > >
+    template <typename T, typename Compare = std::less<T>, typename Alloc = ft::pool_allocator<T>,
+              typename KeyOfValue = ft::identity<T>, typename Node = ft::rb_node<T> >
     class rb_tree
     {
+    public:
+        typedef T value_type;
+        typedef typename ft::remove_const<typename KeyOfValue::result_type>::type key_type;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+        typedef Node node_type;
+        typedef typename Alloc::template rebind<node_type>::other node_allocator_type;
+
     private:
-        rb_node<T> *_root;
+        rb_node_base _header;
         size_t _size;
         Compare _compare;
-        Alloc _allocator;
+        node_allocator_type _allocator;
+
+        // Return type R of the lookups taking an arbitrary key type K, only
+        // available when Compare is transparent.
+        template <typename K, typename R>
+        struct if_transparent : public ft::enable_if<ft::has_is_transparent<Compare, K>::value, R>
+        {
+        };
 
     public:
         typedef rb_iterator<T> iterator;
@@ -226,11 +332,21 @@ namespace ft
         typedef std::reverse_iterator<iterator> reverse_iterator;
         typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
-        rb_tree() : _root(), _size(), _compare(), _allocator() {}
+        rb_tree() : _header(), _size(), _compare(), _allocator()
+        {
+            reset_header();
+        }
+
+        explicit rb_tree(const Compare &compare, const allocator_type &alloc = allocator_type())
+            : _header(), _size(), _compare(compare), _allocator(alloc)
+        {
+            reset_header();
+        }
 
-        rb_tree(const rb_tree &other) : _root(), _size(), _compare(other._compare), _allocator(other._allocator)
+        rb_tree(const rb_tree &other) : _header(), _size(), _compare(other._compare), _allocator(other._allocator)
         {
-            insert(other.begin(), other.end());
+            reset_header();
+            copy_from(other);
         }
 
         ~rb_tree()
@@ -240,19 +356,20 @@ namespace ft
 
         rb_tree &operator=(const rb_tree &other)
         {
-            if (*this == other)
+            if (this == &other)
                 return *this;
             clear();
-            insert(other.begin(), other.end());
+            _compare = other._compare;
+            copy_from(other);
             return *this;
         }
 
-        bool empty()
+        bool empty() const
         {
-            return this->_root == NULL;
+            return this->_size == 0;
         }
 
-        size_t max_size()
+        size_t max_size() const
         {
             return this->_allocator.max_size();
         }
@@ -265,448 +382,1452 @@ namespace ft
         template <typename InputIterator>
         void insert(InputIterator first, InputIterator last)
         {
-            while (first != last)
-                insert(*first++);
+            insert_equal(first, last);
         }
 
-        void insert(const T &value)
+        iterator insert(const T &value)
         {
-            rb_node<T> *node = _allocator.allocate(1);
-            _allocator.construct(node, value);
+            node_type *node = create_node(value);
             rb_insert(node);
             ++_size;
+            return iterator(node);
         }
 
-        void rb_insert(rb_node<T> *node)
+        iterator insert_equal(const T &value)
         {
-            rb_node<T> *y = NULL;
-            rb_node<T> *x = this->_root;
-            while (x != NULL)
-            {
-                y = x;
-                if (_compare(node->value, x->value))
-                    x = x->left;
-                else
-                    x = x->right;
-            }
-            node->parent = y;
-            if (y == NULL)
-                this->_root = node;
-            else if (_compare(node->value, y->value))
-                y->left = node;
-            else
-                y->right = node;
-            node->left = NULL;
-            node->right = NULL;
-            node->color = RB_RED;
-            rb_insert_fixup(node);
+            return insert(value);
         }
 
-        void remove(const T &value)
+        iterator insert_equal(const_iterator hint, const T &value)
         {
-            rb_node<T> *x = this->_root;
-            while (x != NULL)
+            rb_node_base *position = const_cast<rb_node_base *>(hint.base());
+            const key_type &k = KeyOfValue()(value);
+
+            if (position == &this->_header)
             {
-                if (_compare(value, x->value))
-                    x = x->left;
-                else if (_compare(x->value, value))
-                    x = x->right;
-                else
-                    break;
+                if (_size != 0 && !_compare(k, key(this->_header.right)))
+                    return link(create_node(value), this->_header.right, false);
+                return insert(value);
             }
-            if (x != NULL)
+            if (!_compare(key(position), k))
             {
-                rb_node<T> *z;
-                rb_node<T> *y = x;
-                rb_color yc = y->color;
-                if (x->left == NULL)
+                if (position == this->_header.left)
+                    return link(create_node(value), position, true);
+                rb_node_base *before = rb_node_base::predecessor(position);
+                if (!_compare(k, key(before)))
                 {
-                    z = x->right;
-                    transplant(x, x->right);
+                    if (before->right == NULL)
+                        return link(create_node(value), before, false);
+                    return link(create_node(value), position, true);
                 }
-                else if (x->right == NULL)
+                return insert(value);
+            }
+            if (position == this->_header.right)
+                return link(create_node(value), position, false);
+            rb_node_base *after = rb_node_base::successor(position);
+            if (!_compare(key(after), k))
+            {
+                if (position->right == NULL)
+                    return link(create_node(value), position, false);
+                return link(create_node(value), after, true);
+            }
+            return insert(value);
+        }
+
+        template <typename InputIterator>
+        void insert_equal(InputIterator first, InputIterator last)
+        {
+            insert_range(first, last, false, typename std::iterator_traits<InputIterator>::iterator_category());
+        }
+
+        ft::pair<iterator, bool> insert_unique(const T &value)
+        {
+            rb_node_base *parent;
+            bool insert_left;
+            rb_node_base *existing = unique_position(KeyOfValue()(value), parent, insert_left);
+            if (existing != NULL)
+                return ft::pair<iterator, bool>(iterator(existing), false);
+            return ft::pair<iterator, bool>(link(create_node(value), parent, insert_left), true);
+        }
+
+        // Looks up @c k and, when it is absent, links make(k) at the position
+        // found by the same descent: "insert if absent" without a find
+        // followed by a second walk, and without building a value when the
+        // key is already present. make(k) must return a T whose key is k.
+        template <typename K, typename Factory>
+        ft::pair<iterator, bool> find_or_insert(const K &k, Factory make)
+        {
+            rb_node_base *parent;
+            bool insert_left;
+            rb_node_base *existing = unique_position(k, parent, insert_left);
+            if (existing != NULL)
+                return ft::pair<iterator, bool>(iterator(existing), false);
+            return ft::pair<iterator, bool>(link(create_node(make(k)), parent, insert_left), true);
+        }
+
+        // Inserting right before (or right after) a correct hint only costs
+        // the rebalancing, which is amortized O(1): sorted bulk loads that
+        // pass end() as the hint never walk the tree.
+        iterator insert_unique(const_iterator hint, const T &value)
+        {
+            rb_node_base *position = const_cast<rb_node_base *>(hint.base());
+            const key_type &k = KeyOfValue()(value);
+
+            if (position == &this->_header)
+            {
+                if (_size != 0 && _compare(key(this->_header.right), k))
+                    return link(create_node(value), this->_header.right, false);
+                return insert_unique(value).first;
+            }
+            if (_compare(k, key(position)))
+            {
+                if (position == this->_header.left)
+                    return link(create_node(value), position, true);
+                rb_node_base *before = rb_node_base::predecessor(position);
+                if (_compare(key(before), k))
                 {
-                    z = x->left;
-                    transplant(x, x->left);
+                    if (before->right == NULL)
+                        return link(create_node(value), before, false);
+                    return link(create_node(value), position, true);
                 }
-                else
+                return insert_unique(value).first;
+            }
+            if (_compare(key(position), k))
+            {
+                if (position == this->_header.right)
+                    return link(create_node(value), position, false);
+                rb_node_base *after = rb_node_base::successor(position);
+                if (_compare(k, key(after)))
                 {
-                    y = rb_node<T>::leftmost(x->right);
-                    yc = y->color;
-                    z = y->right;
-                    if (y != x->right)
-                    {
-                        transplant(y, y->right);
-                        y->right = x->right;
-                        if (y->right != NULL)
-                            y->right->parent = y;
-                    }
-                    transplant(x, y);
-                    y->left = x->left;
-                    if (y->left != NULL)
-                        y->left->parent = y;
-                    y->color = x->color;
+                    if (position->right == NULL)
+                        return link(create_node(value), position, false);
+                    return link(create_node(value), after, true);
                 }
-                if (yc == RB_BLACK)
-                    rb_delete_fixup(z, y);
-                _allocator.destroy(x);
-                _allocator.deallocate(x, 1);
-                --_size;
+                return insert_unique(value).first;
             }
+            return iterator(position);
         }
 
-        iterator find(const T &value)
+        template <typename InputIterator>
+        void insert_unique(InputIterator first, InputIterator last)
         {
-            rb_node<T> *x = this->_root;
-            while (x != NULL)
-            {
-                if (_compare(value, x->value))
-                    x = x->left;
-                else if (_compare(x->value, value))
-                    x = x->right;
-                else
-                    return iterator(x);
-            }
-            return iterator(x);
+            insert_range(first, last, true, typename std::iterator_traits<InputIterator>::iterator_category());
         }
 
-        const_iterator find(const T &value) const
+        // Replace the contents with [first, last), which must already be
+        // sorted by key. The tree is built bottom-up in O(n) without a single
+        // comparison or rotation (the unique flavour drops repeated keys).
+        template <typename ForwardIterator>
+        void assign_sorted_equal(ForwardIterator first, ForwardIterator last)
         {
-            rb_node<T> *x = this->_root;
-            while (x != NULL)
-            {
-                if (_compare(value, x->value))
-                    x = x->left;
-                else if (_compare(x->value, value))
-                    x = x->right;
-                else
-                    return const_iterator(x);
-            }
-            return const_iterator(x);
+            clear();
+            build_sorted(first, last, false);
         }
 
-        iterator lower_bound(const T &value)
+        template <typename ForwardIterator>
+        void assign_sorted_unique(ForwardIterator first, ForwardIterator last)
         {
-            rb_node<T> *x = this->_root;
-            rb_node<T> *y = NULL;
-            while (x != NULL)
-            {
-                y = x;
-                if (_compare(value, x->value))
-                    x = x->left;
-                else
-                    x = x->right;
-            }
-            return iterator(y);
+            clear();
+            build_sorted(first, last, true);
         }
 
-        const_iterator lower_bound(const T &value) const
+        void rb_insert(node_type *node)
         {
-            rb_node<T> *x = this->_root;
-            rb_node<T> *y = NULL;
+            const key_type &k = KeyOfValue()(node->value);
+            rb_node_base *y = &this->_header;
+            rb_node_base *x = root();
+            bool insert_left = true;
             while (x != NULL)
             {
                 y = x;
-                if (_compare(value, x->value))
-                    x = x->left;
-                else
-                    x = x->right;
+                insert_left = _compare(k, key(x));
+                x = insert_left ? x->left : x->right;
             }
-            return const_iterator(y);
+            attach(node, y, insert_left);
         }
 
-        iterator upper_bound(const T &value)
+        void remove(const key_type &key)
         {
-            rb_node<T> *x = this->_root;
-            rb_node<T> *y = NULL;
-            while (x != NULL)
-            {
-                y = x;
-                if (_compare(value, x->value))
-                    x = x->left;
-                else
-                    x = x->right;
-            }
-            return iterator(y);
+            rb_node_base *x = find_node(key);
+            if (x != &this->_header)
+                erase_node(x);
         }
 
-        const_iterator upper_bound(const T &value) const
+        template <typename K>
+        typename if_transparent<K, void>::type remove(const K &key)
         {
-            rb_node<T> *x = this->_root;
-            rb_node<T> *y = NULL;
-            while (x != NULL)
+            rb_node_base *x = find_node(key);
+            if (x != &this->_header)
+                erase_node(x);
+        }
+
+        void erase(const_iterator position)
+        {
+            erase_node(const_cast<rb_node_base *>(position.base()));
+        }
+
+        void erase(const_iterator first, const_iterator last)
+        {
+            if (first == begin() && last == end())
             {
-                y = x;
-                if (_compare(value, x->value))
-                    x = x->left;
-                else
-                    x = x->right;
+                clear();
+                return;
             }
-            return const_iterator(y);
+            while (first != last)
+                erase(first++);
         }
 
-        void clear()
+        size_t erase(const key_type &key)
         {
-            _size = 0;
-            rb_node<T> *x = rb_node<T>::leftmost(this->_root);
-            rb_node<T> *y = NULL;
-            while (x != NULL)
+            const_iterator first(lower_bound_node(key));
+            const_iterator last(upper_bound_node(key));
+            size_t count = 0;
+            while (first != last)
             {
-                if (x->left != NULL)
-                    x = x->left;
-                else if (x->right != NULL)
-                    x = x->right;
-                else
-                {
-                    y = x->parent;
-                    _allocator.destroy(x);
-                    _allocator.deallocate(x, 1);
-                    if (y != NULL)
-                    {
-                        if (x == y->left)
-                            y->left = NULL;
-                        else
-                            y->right = NULL;
-                    }
-                    x = y;
-                }
+                erase(first++);
+                ++count;
             }
-            this->_root = NULL;
+            return count;
         }
 
-        void swap(rb_tree<T> &other)
+        size_t count(const key_type &key) const
         {
-            std::swap(this->_root, other._root);
-            std::swap(this->_size, other._size);
-            std::swap(this->_compare, other._compare);
+            return count_range(lower_bound_node(key), upper_bound_node(key));
         }
 
-        iterator begin()
+        template <typename K>
+        typename if_transparent<K, size_t>::type count(const K &key) const
         {
-            return iterator(rb_node<T>::leftmost(this->_root));
+            return count_range(lower_bound_node(key), upper_bound_node(key));
         }
 
-        const_iterator begin() const
+        iterator find(const key_type &key)
         {
-            return const_iterator(rb_node<T>::leftmost(this->_root));
+            return iterator(find_node(key));
         }
 
-        iterator end()
+        const_iterator find(const key_type &key) const
         {
-            return ++iterator(rb_node<T>::rightmost(this->_root));
+            return const_iterator(find_node(key));
         }
 
-        const_iterator end() const
+        iterator lower_bound(const key_type &key)
         {
-            return ++const_iterator(rb_node<T>::rightmost(this->_root));
+            return iterator(lower_bound_node(key));
         }
 
-        reverse_iterator rbegin()
+        const_iterator lower_bound(const key_type &key) const
         {
-            return reverse_iterator(iterator(rb_node<T>::leftmost(this->_root)));
+            return const_iterator(lower_bound_node(key));
         }
 
-        const_reverse_iterator rbegin() const
+        iterator upper_bound(const key_type &key)
         {
-            return const_reverse_iterator(const_iterator(rb_node<T>::leftmost(this->_root)));
+            return iterator(upper_bound_node(key));
         }
 
-        reverse_iterator rend()
+        const_iterator upper_bound(const key_type &key) const
         {
-            return reverse_iterator(++iterator(rb_node<T>::rightmost(this->_root)));
+            return const_iterator(upper_bound_node(key));
         }
 
-        const_reverse_iterator rend() const
+        ft::pair<iterator, iterator> equal_range(const key_type &key)
         {
-            return const_reverse_iterator(++const_iterator(rb_node<T>::rightmost(this->_root)));
+            return ft::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
         }
 
-        Alloc get_allocator() const
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &key) const
         {
-            return this->_allocator;
+            return ft::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
         }
 
-        Compare get_comparator() const
+        // Heterogeneous lookups: with a transparent comparator (such as
+        // ft::less<>) any key type comparable with key_type can be probed
+        // directly, without converting it to key_type first.
+
+        template <typename K>
+        typename if_transparent<K, iterator>::type find(const K &key)
         {
-            return this->_compare;
+            return iterator(find_node(key));
         }
 
-    protected:
-        void transplant(rb_node<T> *u, rb_node<T> *v)
+        template <typename K>
+        typename if_transparent<K, const_iterator>::type find(const K &key) const
         {
-            if (u == NULL)
-                return;
-            if (u->parent == NULL)
-                this->_root = v;
-            else if (u == u->parent->left)
-                u->parent->left = v;
+            return const_iterator(find_node(key));
+        }
+
+        template <typename K>
+        typename if_transparent<K, iterator>::type lower_bound(const K &key)
+        {
+            return iterator(lower_bound_node(key));
+        }
+
+        template <typename K>
+        typename if_transparent<K, const_iterator>::type lower_bound(const K &key) const
+        {
+            return const_iterator(lower_bound_node(key));
+        }
+
+        template <typename K>
+        typename if_transparent<K, iterator>::type upper_bound(const K &key)
+        {
+            return iterator(upper_bound_node(key));
+        }
+
+        template <typename K>
+        typename if_transparent<K, const_iterator>::type upper_bound(const K &key) const
+        {
+            return const_iterator(upper_bound_node(key));
+        }
+
+        template <typename K>
+        typename if_transparent<K, ft::pair<iterator, iterator> >::type equal_range(const K &key)
+        {
+            return ft::pair<iterator, iterator>(iterator(lower_bound_node(key)), iterator(upper_bound_node(key)));
+        }
+
+        template <typename K>
+        typename if_transparent<K, ft::pair<const_iterator, const_iterator> >::type equal_range(const K &key) const
+        {
+            return ft::pair<const_iterator, const_iterator>(const_iterator(lower_bound_node(key)),
+                                                            const_iterator(upper_bound_node(key)));
+        }
+
+        // Batched lookups: one result per key of [first, last), written to
+        // out in order, equal to what find / lower_bound would return. The
+        // descents of batch_width keys at a time advance in lockstep, one
+        // level per round, and each lane prefetches the node it reads next
+        // round, so the cache misses of different keys overlap instead of
+        // being paid one after the other. Pays off once the tree no longer
+        // fits in cache.
+
+        static const size_t batch_width = 16;
+
+        template <typename ForwardIterator, typename OutputIterator>
+        OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+        {
+            return batch_lookup<iterator>(first, last, out, true);
+        }
+
+        template <typename ForwardIterator, typename OutputIterator>
+        OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+        {
+            return batch_lookup<const_iterator>(first, last, out, true);
+        }
+
+        template <typename ForwardIterator, typename OutputIterator>
+        OutputIterator lower_bound_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+        {
+            return batch_lookup<iterator>(first, last, out, false);
+        }
+
+        template <typename ForwardIterator, typename OutputIterator>
+        OutputIterator lower_bound_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+        {
+            return batch_lookup<const_iterator>(first, last, out, false);
+        }
+
+        // Order statistics, available when Node is rb_counted_node<T>.
+
+        /// The element at position @c k in iteration order (end() if k >= size()).
+        iterator select(size_t k)
+        {
+            return iterator(select_node(k));
+        }
+
+        const_iterator select(size_t k) const
+        {
+            return const_iterator(select_node(k));
+        }
+
+        /// Number of elements whose key is less than @c k.
+        size_t rank(const key_type &k) const
+        {
+            size_t rank = 0;
+            const rb_node_base *x = root();
+            while (x != NULL)
+            {
+                if (_compare(key(x), k))
+                {
+                    rank += node_type::subtree_size(x->left) + 1;
+                    x = x->right;
+                }
+                else
+                    x = x->left;
+            }
+            return rank;
+        }
+
+        /// Position of @c position in iteration order (size() for end()).
+        size_t index_of(const_iterator position) const
+        {
+            const rb_node_base *x = position.base();
+            if (x == &this->_header)
+                return _size;
+            size_t index = node_type::subtree_size(x->left);
+            for (; x != root(); x = x->parent())
+                if (x == x->parent()->right)
+                    index += node_type::subtree_size(x->parent()->left) + 1;
+            return index;
+        }
+
+        /// std::distance(first, last) in O(log n).
+        std::ptrdiff_t distance(const_iterator first, const_iterator last) const
+        {
+            return static_cast<std::ptrdiff_t>(index_of(last)) - static_cast<std::ptrdiff_t>(index_of(first));
+        }
+
+        void clear()
+        {
+            destroy_subtree(root());
+            reset_header();
+            _size = 0;
+        }
+
+        void swap(rb_tree &other)
+        {
+            std::swap(this->_header, other._header);
+            this->adopt_header();
+            other.adopt_header();
+            std::swap(this->_size, other._size);
+            std::swap(this->_compare, other._compare);
+            using std::swap;
+            swap(this->_allocator, other._allocator);
+        }
+
+        // Split and join relink the existing nodes: nothing is allocated,
+        // copied or freed, and subtrees are joined by black height.
+
+        /// Moves every element whose key is not less than @c k into
+        /// @c greater, whose previous contents are destroyed. Both trees then
+        /// share this tree's allocator. O(log n) only when Node is
+        /// rb_counted_node: plain nodes carry no subtree sizes, so keeping
+        /// size() exact also walks the smaller side, O(min(m, n - m)) for m
+        /// elements moved.
+        void split(const key_type &k, rb_tree &greater)
+        {
+            rb_tree upper(_compare, get_allocator());
+            rb_node_base *r = root();
+            if (r != NULL)
+            {
+                const size_t total = _size;
+                reset_header();
+                rb_node_base *lower_root;
+                rb_node_base *upper_root;
+                size_t lower_height;
+                size_t upper_height;
+                split_subtree(r, black_height(r), k, lower_root, lower_height, upper_root, upper_height);
+                adopt_root(lower_root);
+                upper.adopt_root(upper_root);
+                split_sizes(upper, total, ft::integral_constant<bool, node_type::augmented>());
+            }
+            greater.swap(upper);
+        }
+
+        /// Appends every element of @c right and leaves it empty, keeping
+        /// equivalent keys (the insert_equal flavour). The keys of @c right
+        /// must not be less than the keys of this tree for the O(log n) path;
+        /// overlapping ranges fall back to relinking the nodes one by one,
+        /// and trees whose allocators differ to copying them.
+        void join(rb_tree &right)
+        {
+            if (this == &right || right.empty())
+                return;
+            if (!(this->_allocator == right._allocator))
+            {
+                insert_equal(right.begin(), right.end());
+                right.clear();
+                return;
+            }
+            if (empty())
+            {
+                swap(right);
+                return;
+            }
+            if (_compare(key(right._header.left), key(this->_header.right)))
+            {
+                rb_node_base *r = right.root();
+                right.reset_header();
+                right._size = 0;
+                relink_subtree(r);
+                return;
+            }
+
+            rb_node_base *middle = right._header.left;
+            right.unlink_node(middle);
+            const size_t total = _size + right._size + 1;
+            rb_node_base *left_root = root();
+            rb_node_base *right_root = right.root();
+            const size_t left_height = black_height(left_root);
+            const size_t right_height = black_height(right_root);
+            reset_header();
+            right.reset_header();
+            right._size = 0;
+
+            size_t height;
+            adopt_root(join_subtrees(left_root, left_height, middle, right_root, right_height, height));
+            _size = total;
+        }
+
+        /// join for unique keys: an element of @c right whose key is already
+        /// present stays in @c right, as std::map::merge leaves it. Only when
+        /// every key of @c right is greater than those of this tree does it
+        /// take join's O(log n) path.
+        void join_unique(rb_tree &right)
+        {
+            if (this == &right || right.empty())
+                return;
+            if (empty() || _compare(key(this->_header.right), key(right._header.left)))
+            {
+                join(right);
+                return;
+            }
+            const bool same_allocator = this->_allocator == right._allocator;
+            rb_node_base *x = right._header.left;
+            while (x != &right._header)
+            {
+                rb_node_base *next = rb_node_base::successor(x);
+                rb_node_base *parent;
+                bool insert_left;
+                if (unique_position(key(x), parent, insert_left) == NULL)
+                {
+                    if (same_allocator)
+                    {
+                        right.unlink_node(x);
+                        link(static_cast<node_type *>(x), parent, insert_left);
+                    }
+                    else
+                    {
+                        link(create_node(static_cast<node_type *>(x)->value), parent, insert_left);
+                        right.erase_node(x);
+                    }
+                }
+                x = next;
+            }
+        }
+
+        iterator begin()
+        {
+            return iterator(this->_header.left);
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(this->_header.left);
+        }
+
+        iterator end()
+        {
+            return iterator(&this->_header);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(&this->_header);
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        allocator_type get_allocator() const
+        {
+            return allocator_type(this->_allocator);
+        }
+
+        Compare get_comparator() const
+        {
+            return this->_compare;
+        }
+
+        // Snapshot of the contents as an Eytzinger-ordered search index, for
+        // trees that are built once and then only queried.
+        frozen_index<T, Compare, KeyOfValue> freeze() const
+        {
+            return frozen_index<T, Compare, KeyOfValue>(begin(), end(), _compare);
+        }
+
+    protected:
+        // Storage for a batch of nodes: one contiguous allocation when the
+        // allocator lets the nodes be released individually afterwards.
+        struct node_block
+        {
+            node_type *storage;
+            size_t used;
+            size_t count;
+        };
+
+        rb_node_base *root() const
+        {
+            return this->_header.parent();
+        }
+
+        static const T &value(const rb_node_base *node)
+        {
+            return static_cast<const rb_node<T> *>(node)->value;
+        }
+
+        void reset_header()
+        {
+            this->_header.set_parent(NULL);
+            this->_header.left = &this->_header;
+            this->_header.right = &this->_header;
+            this->_header.set_color(RB_RED);
+        }
+
+        // After the header has been copied from another tree, point the root
+        // back at this header (or make an empty header self-referencing).
+        void adopt_header()
+        {
+            if (root() == NULL)
+                reset_header();
+            else
+                root()->set_parent(&this->_header);
+        }
+
+        // Installs the detached subtree @c r as the whole tree.
+        void adopt_root(rb_node_base *r)
+        {
+            if (r == NULL)
+            {
+                reset_header();
+                return;
+            }
+            r->set_parent(&this->_header);
+            r->set_color(RB_BLACK);
+            this->_header.set_parent(r);
+            this->_header.left = rb_node_base::leftmost(r);
+            this->_header.right = rb_node_base::rightmost(r);
+        }
+
+        // Black nodes on any path from @c x down to a leaf, @c x included.
+        static size_t black_height(const rb_node_base *x)
+        {
+            size_t height = 0;
+            for (; x != NULL; x = x->left)
+                height += x->color() == RB_BLACK;
+            return height;
+        }
+
+        // Splits the detached subtree @c x of black height @c height into the
+        // keys less than @c k and the others, as detached subtrees with
+        // their black heights.
+        void split_subtree(rb_node_base *x, size_t height, const key_type &k, rb_node_base *&lower,
+                           size_t &lower_height, rb_node_base *&upper, size_t &upper_height)
+        {
+            if (x == NULL)
+            {
+                lower = NULL;
+                upper = NULL;
+                lower_height = 0;
+                upper_height = 0;
+                return;
+            }
+            const size_t child_height = height - (x->color() == RB_BLACK);
+            rb_node_base *left = x->left;
+            rb_node_base *right = x->right;
+            if (_compare(key(x), k))
+            {
+                rb_node_base *rest;
+                size_t rest_height;
+                split_subtree(right, child_height, k, rest, rest_height, upper, upper_height);
+                lower = join_subtrees(left, child_height, x, rest, rest_height, lower_height);
+            }
+            else
+            {
+                rb_node_base *rest;
+                size_t rest_height;
+                split_subtree(left, child_height, k, lower, lower_height, rest, rest_height);
+                upper = join_subtrees(rest, rest_height, x, right, child_height, upper_height);
+            }
+        }
+
+        /**
+         * @brief Joins the detached subtrees @c left < @c middle < @c right
+         * into one, returned detached with its black height in @c height.
+         * The middle node hangs, red, off the spine of the taller subtree
+         * at the black node whose black height matches the shorter one, and
+         * the insertion fixup repairs a red parent. The header briefly holds
+         * the taller subtree so that the fixup and rotations find its root.
+         */
+        rb_node_base *join_subtrees(rb_node_base *left, size_t left_height, rb_node_base *middle,
+                                    rb_node_base *right, size_t right_height, size_t &height)
+        {
+            if (left != NULL && left->color() == RB_RED)
+            {
+                left->set_color(RB_BLACK);
+                ++left_height;
+            }
+            if (right != NULL && right->color() == RB_RED)
+            {
+                right->set_color(RB_BLACK);
+                ++right_height;
+            }
+            if (left_height == right_height)
+            {
+                middle->left = left;
+                middle->right = right;
+                if (left != NULL)
+                    left->set_parent(middle);
+                if (right != NULL)
+                    right->set_parent(middle);
+                middle->set_color(RB_BLACK);
+                node_type::update(middle);
+                height = left_height + 1;
+                return middle;
+            }
+
+            const bool taller_left = left_height > right_height;
+            rb_node_base *x = taller_left ? left : right;
+            const size_t target = taller_left ? right_height : left_height;
+            size_t x_height = taller_left ? left_height : right_height;
+            rb_node_base *parent = NULL;
+            this->_header.set_parent(x);
+            x->set_parent(&this->_header);
+            while (x_height > target || (x != NULL && x->color() == RB_RED))
+            {
+                x_height -= x->color() == RB_BLACK;
+                parent = x;
+                x = taller_left ? x->right : x->left;
+            }
+            middle->left = taller_left ? x : left;
+            middle->right = taller_left ? right : x;
+            if (middle->left != NULL)
+                middle->left->set_parent(middle);
+            if (middle->right != NULL)
+                middle->right->set_parent(middle);
+            middle->set_parent(parent);
+            if (taller_left)
+                parent->right = middle;
+            else
+                parent->left = middle;
+            middle->set_color(RB_RED);
+            node_type::update(middle);
+            update_path(parent);
+            height = (taller_left ? left_height : right_height) + rb_insert_fixup(middle);
+
+            rb_node_base *r = root();
+            this->_header.set_parent(NULL);
+            return r;
+        }
+
+        void split_sizes(rb_tree &upper, size_t total, ft::true_type)
+        {
+            _size = node_type::subtree_size(root());
+            upper._size = total - _size;
+        }
+
+        // Without subtree counts, count whichever half runs out first.
+        void split_sizes(rb_tree &upper, size_t total, ft::false_type)
+        {
+            const_iterator a = begin();
+            const_iterator b = upper.begin();
+            size_t n = 0;
+            for (; a != end() && b != upper.end(); ++a, ++b)
+                ++n;
+            _size = a == end() ? n : total - n;
+            upper._size = total - _size;
+        }
+
+        // Inserts every node of the detached subtree @c x as it is.
+        void relink_subtree(rb_node_base *x)
+        {
+            if (x == NULL)
+                return;
+            rb_node_base *left = x->left;
+            rb_node_base *right = x->right;
+            rb_insert(static_cast<node_type *>(x));
+            ++_size;
+            relink_subtree(left);
+            relink_subtree(right);
+        }
+
+        static const key_type &key(const rb_node_base *node)
+        {
+            return KeyOfValue()(value(node));
+        }
+
+        // Links a fresh node as the left or right child of @c parent, which
+        // must be a valid insertion point, and rebalances.
+        void attach(node_type *node, rb_node_base *parent, bool insert_left)
+        {
+            node->set_parent(parent);
+            node->left = NULL;
+            node->right = NULL;
+            node->set_color(RB_RED);
+            node_type::update(node);
+            if (parent == &this->_header)
+            {
+                this->_header.set_parent(node);
+                this->_header.left = node;
+                this->_header.right = node;
+            }
+            else if (insert_left)
+            {
+                parent->left = node;
+                if (parent == this->_header.left)
+                    this->_header.left = node;
+            }
+            else
+            {
+                parent->right = node;
+                if (parent == this->_header.right)
+                    this->_header.right = node;
+            }
+            update_path(parent);
+            rb_insert_fixup(node);
+        }
+
+        iterator link(node_type *node, rb_node_base *parent, bool insert_left)
+        {
+            attach(node, parent, insert_left);
+            ++_size;
+            return iterator(node);
+        }
+
+        // Descends once towards @c k. Returns the node holding an equivalent
+        // key, or NULL with @c parent / @c insert_left set to the place where
+        // a node with key k must be attached.
+        template <typename K>
+        rb_node_base *unique_position(const K &k, rb_node_base *&parent, bool &insert_left)
+        {
+            rb_node_base *y = &this->_header;
+            rb_node_base *x = root();
+            insert_left = true;
+            while (x != NULL)
+            {
+                y = x;
+                insert_left = _compare(k, key(x));
+                x = insert_left ? x->left : x->right;
+            }
+            parent = y;
+            rb_node_base *candidate = y;
+            if (insert_left)
+            {
+                if (y == this->_header.left)
+                    return NULL;
+                candidate = rb_node_base::predecessor(y);
+            }
+            if (_compare(key(candidate), k))
+                return NULL;
+            return candidate;
+        }
+
+        rb_node_base *select_node(size_t k) const
+        {
+            rb_node_base *x = root();
+            while (x != NULL)
+            {
+                const size_t left = node_type::subtree_size(x->left);
+                if (k == left)
+                    return x;
+                if (k < left)
+                    x = x->left;
+                else
+                {
+                    k -= left + 1;
+                    x = x->right;
+                }
+            }
+            return const_cast<rb_node_base *>(&this->_header);
+        }
+
+        static size_t count_range(const rb_node_base *first, const rb_node_base *last)
+        {
+            size_t count = 0;
+            for (const_iterator it(first); it != const_iterator(last); ++it)
+                ++count;
+            return count;
+        }
+
+        template <typename K>
+        rb_node_base *find_node(const K &k) const
+        {
+            rb_node_base *x = lower_bound_node(k);
+            if (x == &this->_header || _compare(k, key(x)))
+                return const_cast<rb_node_base *>(&this->_header);
+            return x;
+        }
+
+        template <typename K>
+        rb_node_base *lower_bound_node(const K &k) const
+        {
+            rb_node_base *x = root();
+            const rb_node_base *y = &this->_header;
+            while (x != NULL)
+            {
+                if (!_compare(key(x), k))
+                {
+                    y = x;
+                    x = x->left;
+                }
+                else
+                    x = x->right;
+            }
+            return const_cast<rb_node_base *>(y);
+        }
+
+        // lower_bound_node for up to batch_width keys at once; with @c exact,
+        // bounds that do not compare equal become end() as in find_node.
+        template <typename Result, typename ForwardIterator, typename OutputIterator>
+        OutputIterator batch_lookup(ForwardIterator first, ForwardIterator last, OutputIterator out, bool exact) const
+        {
+            ForwardIterator keys[batch_width];
+            const rb_node_base *node[batch_width];
+            const rb_node_base *bound[batch_width];
+
+            while (first != last)
+            {
+                size_t n = 0;
+                for (; n < batch_width && first != last; ++n, ++first)
+                {
+                    keys[n] = first;
+                    node[n] = root();
+                    bound[n] = &this->_header;
+                }
+                for (bool active = true; active;)
+                {
+                    active = false;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        const rb_node_base *x = node[i];
+                        if (x == NULL)
+                            continue;
+                        if (!_compare(key(x), *keys[i]))
+                        {
+                            bound[i] = x;
+                            x = x->left;
+                        }
+                        else
+                            x = x->right;
+                        FT_PREFETCH(x);
+                        node[i] = x;
+                        active = true;
+                    }
+                }
+                for (size_t i = 0; i < n; ++i, ++out)
+                {
+                    const rb_node_base *y = bound[i];
+                    if (exact && y != &this->_header && _compare(*keys[i], key(y)))
+                        y = &this->_header;
+                    *out = Result(const_cast<rb_node_base *>(y));
+                }
+            }
+            return out;
+        }
+
+        template <typename K>
+        rb_node_base *upper_bound_node(const K &k) const
+        {
+            rb_node_base *x = root();
+            const rb_node_base *y = &this->_header;
+            while (x != NULL)
+            {
+                if (_compare(k, key(x)))
+                {
+                    y = x;
+                    x = x->left;
+                }
+                else
+                    x = x->right;
+            }
+            return const_cast<rb_node_base *>(y);
+        }
+
+        template <typename InputIterator>
+        void insert_range(InputIterator first, InputIterator last, bool unique, std::input_iterator_tag)
+        {
+            for (; first != last; ++first)
+            {
+                if (unique)
+                    insert_unique(end(), *first);
+                else
+                    insert_equal(end(), *first);
+            }
+        }
+
+        // A multi-pass range loaded into an empty tree is checked for order
+        // first: copies of other containers and sorted bulk loads then take
+        // the linear build path instead of n descents and fixups.
+        template <typename ForwardIterator>
+        void insert_range(ForwardIterator first, ForwardIterator last, bool unique, std::forward_iterator_tag)
+        {
+            if (empty() && is_sorted(first, last))
+                build_sorted(first, last, unique);
+            else
+                insert_range(first, last, unique, std::input_iterator_tag());
+        }
+
+        template <typename ForwardIterator>
+        bool is_sorted(ForwardIterator first, ForwardIterator last) const
+        {
+            if (first == last)
+                return true;
+            ForwardIterator next = first;
+            for (++next; next != last; ++first, ++next)
+                if (_compare(KeyOfValue()(*next), KeyOfValue()(*first)))
+                    return false;
+            return true;
+        }
+
+        template <typename ForwardIterator>
+        void build_sorted(ForwardIterator first, ForwardIterator last, bool unique)
+        {
+            const size_t n = std::distance(first, last);
+            if (n == 0)
+                return;
+
+            node_block block = reserve_nodes(n);
+            rb_node_base *head = NULL;
+            rb_node_base *tail = NULL;
+            size_t count = 0;
+            try
+            {
+                // Chain the new nodes in order through their right pointers.
+                for (; first != last; ++first)
+                {
+                    if (unique && tail != NULL && !_compare(key(tail), KeyOfValue()(*first)))
+                        continue;
+                    node_type *node = take_node(block, *first);
+                    node->right = NULL;
+                    if (tail == NULL)
+                        head = node;
+                    else
+                        tail->right = node;
+                    tail = node;
+                    ++count;
+                }
+            }
+            catch (...)
+            {
+                while (head != NULL)
+                {
+                    rb_node_base *next = head->right;
+                    destroy_node(head);
+                    head = next;
+                }
+                release_block(block);
+                throw;
+            }
+            release_block(block);
+
+            // Every level but the deepest is full; colouring exactly that
+            // level red (unless it is full too) balances the black heights.
+            size_t height = 0;
+            while ((static_cast<size_t>(2) << height) <= count)
+                ++height;
+            const size_t red_depth = count == (static_cast<size_t>(2) << height) - 1 ? static_cast<size_t>(-1) : height;
+
+            rb_node_base *list = head;
+            rb_node_base *r = link_balanced(list, count, 0, red_depth);
+            r->set_parent(&this->_header);
+            this->_header.set_parent(r);
+            this->_header.left = head;
+            this->_header.right = tail;
+            this->_size = count;
+        }
+
+        static rb_node_base *link_balanced(rb_node_base *&list, size_t n, size_t depth, size_t red_depth)
+        {
+            if (n == 0)
+                return NULL;
+            const size_t left_count = (n - 1) / 2;
+            rb_node_base *left = link_balanced(list, left_count, depth + 1, red_depth);
+            rb_node_base *node = list;
+            list = list->right;
+            node->left = left;
+            if (left != NULL)
+                left->set_parent(node);
+            node->set_color(depth == red_depth ? RB_RED : RB_BLACK);
+            node->right = link_balanced(list, n - 1 - left_count, depth + 1, red_depth);
+            if (node->right != NULL)
+                node->right->set_parent(node);
+            node_type::update(node);
+            return node;
+        }
+
+        // O(n) copy that reproduces the source's shape and colours.
+        void copy_from(const rb_tree &other)
+        {
+            if (other.root() == NULL)
+                return;
+            node_block block = reserve_nodes(other._size);
+            rb_node_base *r;
+            try
+            {
+                r = clone(other.root(), &this->_header, block);
+            }
+            catch (...)
+            {
+                release_block(block);
+                throw;
+            }
+            release_block(block);
+            this->_header.set_parent(r);
+            this->_header.left = rb_node_base::leftmost(r);
+            this->_header.right = rb_node_base::rightmost(r);
+            this->_size = other._size;
+        }
+
+        rb_node_base *clone(const rb_node_base *x, rb_node_base *parent, node_block &block)
+        {
+            rb_node_base *left = NULL;
+            if (x->left != NULL)
+                left = clone(x->left, NULL, block);
+            node_type *node;
+            try
+            {
+                node = take_node(block, value(x));
+            }
+            catch (...)
+            {
+                destroy_subtree(left);
+                throw;
+            }
+            node->set_parent(parent);
+            node->left = left;
+            node->right = NULL;
+            node->set_color(x->color());
+            if (left != NULL)
+                left->set_parent(node);
+            if (x->right != NULL)
+            {
+                try
+                {
+                    node->right = clone(x->right, node, block);
+                }
+                catch (...)
+                {
+                    destroy_subtree(node);
+                    throw;
+                }
+            }
+            node_type::update(node);
+            return node;
+        }
+
+        node_block reserve_nodes(size_t n)
+        {
+            node_block block;
+            block.storage = NULL;
+            block.used = 0;
+            block.count = n;
+            if (ft::allows_partial_deallocation<node_allocator_type>::value && n > 1)
+                block.storage = _allocator.allocate(n);
+            return block;
+        }
+
+        node_type *take_node(node_block &block, const T &value)
+        {
+            if (block.storage == NULL)
+                return create_node(value);
+            node_type *node = block.storage + block.used;
+            ::new (static_cast<void *>(node)) node_type(value);
+            ++block.used;
+            return node;
+        }
+
+        void release_block(node_block &block)
+        {
+            if (block.storage != NULL && block.used < block.count)
+                _allocator.deallocate(block.storage + block.used, block.count - block.used);
+            block.storage = NULL;
+        }
+
+        node_type *create_node(const T &value)
+        {
+            node_type *node = _allocator.allocate(1);
+            try
+            {
+                ::new (static_cast<void *>(node)) node_type(value);
+            }
+            catch (...)
+            {
+                _allocator.deallocate(node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        void destroy_node(rb_node_base *node)
+        {
+            node_type *x = static_cast<node_type *>(node);
+            _allocator.destroy(x);
+            _allocator.deallocate(x, 1);
+        }
+
+        void destroy_subtree(rb_node_base *x)
+        {
+            while (x != NULL)
+            {
+                destroy_subtree(x->right);
+                rb_node_base *y = x->left;
+                destroy_node(x);
+                x = y;
+            }
+        }
+
+        void erase_node(rb_node_base *x)
+        {
+            unlink_node(x);
+            destroy_node(x);
+        }
+
+        // Takes @c x out of the tree, rebalancing, without destroying it.
+        void unlink_node(rb_node_base *x)
+        {
+            if (x == this->_header.left)
+                this->_header.left = x->right != NULL ? rb_node_base::leftmost(x->right) : x->parent();
+            if (x == this->_header.right)
+                this->_header.right = x->left != NULL ? rb_node_base::rightmost(x->left) : x->parent();
+
+            rb_node_base *z;
+            rb_node_base *z_parent;
+            rb_node_base *y = x;
+            rb_color yc = y->color();
+            if (x->left == NULL)
+            {
+                z = x->right;
+                z_parent = x->parent();
+                transplant(x, x->right);
+            }
+            else if (x->right == NULL)
+            {
+                z = x->left;
+                z_parent = x->parent();
+                transplant(x, x->left);
+            }
+            else
+            {
+                y = rb_node_base::leftmost(x->right);
+                yc = y->color();
+                z = y->right;
+                z_parent = y;
+                if (y != x->right)
+                {
+                    z_parent = y->parent();
+                    transplant(y, y->right);
+                    y->right = x->right;
+                    y->right->set_parent(y);
+                }
+                transplant(x, y);
+                y->left = x->left;
+                y->left->set_parent(y);
+                y->set_color(x->color());
+            }
+            update_path(z_parent);
+            if (yc == RB_BLACK)
+                rb_delete_fixup(z, z_parent);
+            --_size;
+        }
+
+        // Refreshes the augmentation of @c node and all its ancestors after a
+        // node was linked below, or unlinked from below, @c node.
+        void update_path(rb_node_base *node)
+        {
+            if (!node_type::augmented)
+                return;
+            for (; node != &this->_header; node = node->parent())
+                node_type::update(node);
+        }
+
+        void transplant(rb_node_base *u, rb_node_base *v)
+        {
+            if (u == root())
+                this->_header.set_parent(v);
+            else if (u == u->parent()->left)
+                u->parent()->left = v;
             else
-                u->parent->right = v;
+                u->parent()->right = v;
             if (v)
-                v->parent = u->parent;
+                v->set_parent(u->parent());
         }
 
-        void rb_delete_fixup(rb_node<T> *node, rb_node<T> *node_parent)
+        void rb_delete_fixup(rb_node_base *node, rb_node_base *node_parent)
         {
-            while (node != this->_root && (node == NULL || node->color == RB_BLACK))
+            while (node != root() && (node == NULL || node->color() == RB_BLACK))
             {
                 if (node == node_parent->left)
                 {
-                    rb_node<T> *w = node_parent->right;
-                    if (w != NULL && w->color == RB_RED)
+                    rb_node_base *w = node_parent->right;
+                    if (w->color() == RB_RED)
                     {
-                        w->color = RB_BLACK;
-                        node_parent->color = RB_RED;
+                        w->set_color(RB_BLACK);
+                        node_parent->set_color(RB_RED);
                         this->rb_left_rotate(node_parent);
                         w = node_parent->right;
                     }
-                    if (w == NULL || ((w->left == NULL || w->left->color == RB_BLACK) && (w->right == NULL || w->right->color == RB_BLACK)))
+                    if ((w->left == NULL || w->left->color() == RB_BLACK) && (w->right == NULL || w->right->color() == RB_BLACK))
                     {
-                        if (w != NULL)
-                            w->color = RB_RED;
+                        w->set_color(RB_RED);
                         node = node_parent;
-                        if (node != NULL)
-                            node_parent = node->parent;
+                        node_parent = node->parent();
                     }
                     else
                     {
-                        if (w->right == NULL || w->right->color == RB_BLACK)
+                        if (w->right == NULL || w->right->color() == RB_BLACK)
                         {
-                            w->left->color = RB_BLACK;
-                            w->color = RB_RED;
+                            w->left->set_color(RB_BLACK);
+                            w->set_color(RB_RED);
                             this->rb_right_rotate(w);
                             w = node_parent->right;
                         }
-                        w->color = node_parent->color;
-                        node_parent->color = RB_BLACK;
-                        w->right->color = RB_BLACK;
+                        w->set_color(node_parent->color());
+                        node_parent->set_color(RB_BLACK);
+                        if (w->right != NULL)
+                            w->right->set_color(RB_BLACK);
                         this->rb_left_rotate(node_parent);
-                        node = this->_root;
+                        node = root();
                     }
                 }
                 else
                 {
-                    rb_node<T> *w = node_parent->left;
-                    if (w != NULL && w->color == RB_RED)
+                    rb_node_base *w = node_parent->left;
+                    if (w->color() == RB_RED)
                     {
-                        w->color = RB_BLACK;
-                        node_parent->color = RB_RED;
+                        w->set_color(RB_BLACK);
+                        node_parent->set_color(RB_RED);
                         this->rb_right_rotate(node_parent);
                         w = node_parent->left;
                     }
-                    if (w == NULL || ((w->right == NULL || w->right->color == RB_BLACK) && (w->left == NULL || w->left->color == RB_BLACK)))
+                    if ((w->right == NULL || w->right->color() == RB_BLACK) && (w->left == NULL || w->left->color() == RB_BLACK))
                     {
-                        if (w != NULL)
-                            w->color = RB_RED;
+                        w->set_color(RB_RED);
                         node = node_parent;
-                        if (node != NULL)
-                            node_parent = node->parent;
+                        node_parent = node->parent();
                     }
                     else
                     {
-                        if (w->left == NULL || w->left->color == RB_BLACK)
+                        if (w->left == NULL || w->left->color() == RB_BLACK)
                         {
-                            w->right->color = RB_BLACK;
-                            w->color = RB_RED;
+                            w->right->set_color(RB_BLACK);
+                            w->set_color(RB_RED);
                             this->rb_left_rotate(w);
                             w = node_parent->left;
                         }
-                        w->color = node_parent->color;
-                        node_parent->color = RB_BLACK;
-                        w->left->color = RB_BLACK;
+                        w->set_color(node_parent->color());
+                        node_parent->set_color(RB_BLACK);
+                        if (w->left != NULL)
+                            w->left->set_color(RB_BLACK);
                         this->rb_right_rotate(node_parent);
-                        node = this->_root;
+                        node = root();
                     }
                 }
             }
             if (node != NULL)
-                node->color = RB_BLACK;
+                node->set_color(RB_BLACK);
         }
 
-        void rb_insert_fixup(rb_node<T> *node)
+        // Returns whether the black height of the tree grew, which happens
+        // when the recolouring reaches the root.
+        bool rb_insert_fixup(rb_node_base *node)
         {
-            while (node->parent != NULL && node->parent->color == RB_RED)
+            while (node != root() && node->parent()->color() == RB_RED)
             {
-                if (node->parent == node->parent->parent->left)
+                rb_node_base *grandparent = node->parent()->parent();
+                if (node->parent() == grandparent->left)
                 {
-                    rb_node<T> *y = node->parent->parent->right;
-                    if (y != NULL && y->color == RB_RED)
+                    rb_node_base *y = grandparent->right;
+                    if (y != NULL && y->color() == RB_RED)
                     {
-                        node->parent->color = RB_BLACK;
-                        y->color = RB_BLACK;
-                        node->parent->parent->color = RB_RED;
-                        node = node->parent->parent;
+                        node->parent()->set_color(RB_BLACK);
+                        y->set_color(RB_BLACK);
+                        grandparent->set_color(RB_RED);
+                        node = grandparent;
                     }
                     else
                     {
-                        if (node == node->parent->right)
+                        if (node == node->parent()->right)
                         {
-                            node = node->parent;
+                            node = node->parent();
                             rb_left_rotate(node);
                         }
-                        node->parent->color = RB_BLACK;
-                        node->parent->parent->color = RB_RED;
-                        rb_right_rotate(node->parent->parent);
+                        node->parent()->set_color(RB_BLACK);
+                        grandparent->set_color(RB_RED);
+                        rb_right_rotate(grandparent);
                     }
                 }
                 else
                 {
-                    rb_node<T> *y = node->parent->parent->left;
-                    if (y != NULL && y->color == RB_RED)
+                    rb_node_base *y = grandparent->left;
+                    if (y != NULL && y->color() == RB_RED)
                     {
-                        node->parent->color = RB_BLACK;
-                        y->color = RB_BLACK;
-                        node->parent->parent->color = RB_RED;
-                        node = node->parent->parent;
+                        node->parent()->set_color(RB_BLACK);
+                        y->set_color(RB_BLACK);
+                        grandparent->set_color(RB_RED);
+                        node = grandparent;
                     }
                     else
                     {
-                        if (node == node->parent->left)
+                        if (node == node->parent()->left)
                         {
-                            node = node->parent;
+                            node = node->parent();
                             rb_right_rotate(node);
                         }
-                        node->parent->color = RB_BLACK;
-                        node->parent->parent->color = RB_RED;
-                        rb_left_rotate(node->parent->parent);
+                        node->parent()->set_color(RB_BLACK);
+                        grandparent->set_color(RB_RED);
+                        rb_left_rotate(grandparent);
                     }
                 }
             }
-            this->_root->color = RB_BLACK;
+            const bool grew = root()->color() == RB_RED;
+            root()->set_color(RB_BLACK);
+            return grew;
         }
 
-        void rb_left_rotate(rb_node<T> *node)
+        void rb_left_rotate(rb_node_base *node)
         {
-            rb_node<T> *y = node->right;
+            rb_node_base *y = node->right;
             node->right = y->left;
             if (y->left != NULL)
-                y->left->parent = node;
-            y->parent = node->parent;
-            if (node->parent == NULL)
-                this->_root = y;
-            else if (node == node->parent->left)
-                node->parent->left = y;
+                y->left->set_parent(node);
+            y->set_parent(node->parent());
+            if (node == root())
+                this->_header.set_parent(y);
+            else if (node == node->parent()->left)
+                node->parent()->left = y;
             else
-                node->parent->right = y;
+                node->parent()->right = y;
             y->left = node;
-            node->parent = y;
+            node->set_parent(y);
+            node_type::update(node);
+            node_type::update(y);
         }
 
-        void rb_right_rotate(rb_node<T> *node)
+        void rb_right_rotate(rb_node_base *node)
         {
-            rb_node<T> *y = node->left;
+            rb_node_base *y = node->left;
             node->left = y->right;
             if (y->right != NULL)
-                y->right->parent = node;
-            y->parent = node->parent;
-            if (node->parent == NULL)
-                this->_root = y;
-            else if (node == node->parent->right)
-                node->parent->right = y;
+                y->right->set_parent(node);
+            y->set_parent(node->parent());
+            if (node == root())
+                this->_header.set_parent(y);
+            else if (node == node->parent()->right)
+                node->parent()->right = y;
             else
-                node->parent->left = y;
+                node->parent()->left = y;
             y->right = node;
-            node->parent = y;
+            node->set_parent(y);
+            node_type::update(node);
+            node_type::update(y);
         }
     };
 }
@@ -0,0 +1,253 @@
+#ifndef COMPARE_HPP
+# define COMPARE_HPP
+
+# include <cstring>
+# include <cstddef>
+# include <algorithm>
+
+# include "util/type_traits.hpp"
+
+# if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#  define FT_COMPARE_X86 1
+#  include <immintrin.h>
+# endif
+
+namespace ft
+{
+
+  // Equality and lexicographical comparison of contiguous ranges, used by
+  // the ft::vector (and through it ft::stack) comparison operators. Ranges
+  // of integral types are compared as raw bytes: memcmp for equality and a
+  // vectorised first-mismatch scan for ordering. Floating point ranges use
+  // vectorised IEEE comparisons so that NaN and +0.0 / -0.0 behave exactly
+  // like the element operators. On x86 the kernels use AVX2 when the CPU
+  // supports it (checked once at run time) and SSE2 otherwise; everything
+  // else falls back to the scalar loops.
+
+  inline std::size_t __mismatch_bytes_scalar(const unsigned char *a, const unsigned char *b, std::size_t n)
+  {
+    std::size_t i = 0;
+    while (i < n && a[i] == b[i])
+      ++i;
+    return i;
+  }
+
+  template <class T>
+  std::size_t __mismatch_scalar(const T *a, const T *b, std::size_t n)
+  {
+    std::size_t i = 0;
+    while (i < n && a[i] == b[i])
+      ++i;
+    return i;
+  }
+
+# ifdef FT_COMPARE_X86
+
+  inline std::size_t __mismatch_bytes_sse2(const unsigned char *a, const unsigned char *b, std::size_t n)
+  {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+      const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+      const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+      const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) ^ 0xFFFFu;
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+    return i + __mismatch_bytes_scalar(a + i, b + i, n - i);
+  }
+
+  __attribute__((target("avx2")))
+  inline std::size_t __mismatch_bytes_avx2(const unsigned char *a, const unsigned char *b, std::size_t n)
+  {
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+      const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+      const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+      const unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+    return i + __mismatch_bytes_sse2(a + i, b + i, n - i);
+  }
+
+  inline std::size_t __mismatch_sse2(const float *a, const float *b, std::size_t n)
+  {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)))) ^ 0xFu;
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+    return i + __mismatch_scalar(a + i, b + i, n - i);
+  }
+
+  inline std::size_t __mismatch_sse2(const double *a, const double *b, std::size_t n)
+  {
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+      const unsigned int mask = static_cast<unsigned int>(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)))) ^ 0x3u;
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+    return i + __mismatch_scalar(a + i, b + i, n - i);
+  }
+
+  __attribute__((target("avx2")))
+  inline std::size_t __mismatch_avx2(const float *a, const float *b, std::size_t n)
+  {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+      const __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_EQ_OQ);
+      const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(eq)) ^ 0xFFu;
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+    return i + __mismatch_sse2(a + i, b + i, n - i);
+  }
+
+  __attribute__((target("avx2")))
+  inline std::size_t __mismatch_avx2(const double *a, const double *b, std::size_t n)
+  {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const __m256d eq = _mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_EQ_OQ);
+      const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_pd(eq)) ^ 0xFu;
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+    return i + __mismatch_sse2(a + i, b + i, n - i);
+  }
+
+  inline bool __cpu_has_avx2()
+  {
+    static const bool has_avx2 = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+    return has_avx2;
+  }
+
+# endif
+
+  /// Index of the first differing byte of @c a and @c b, or @c n.
+  inline std::size_t mismatch_bytes(const void *a, const void *b, std::size_t n)
+  {
+    const unsigned char *x = static_cast<const unsigned char *>(a);
+    const unsigned char *y = static_cast<const unsigned char *>(b);
+# ifdef FT_COMPARE_X86
+    return __cpu_has_avx2() ? __mismatch_bytes_avx2(x, y, n) : __mismatch_bytes_sse2(x, y, n);
+# else
+    return __mismatch_bytes_scalar(x, y, n);
+# endif
+  }
+
+  /// Index of the first i with !(a[i] == b[i]), or @c n.
+  template <class T>
+  std::size_t mismatch_elements(const T *a, const T *b, std::size_t n)
+  {
+    return __mismatch_scalar(a, b, n);
+  }
+
+# ifdef FT_COMPARE_X86
+  inline std::size_t mismatch_elements(const float *a, const float *b, std::size_t n)
+  {
+    return __cpu_has_avx2() ? __mismatch_avx2(a, b, n) : __mismatch_sse2(a, b, n);
+  }
+
+  inline std::size_t mismatch_elements(const double *a, const double *b, std::size_t n)
+  {
+    return __cpu_has_avx2() ? __mismatch_avx2(a, b, n) : __mismatch_sse2(a, b, n);
+  }
+# endif
+
+  // Range kinds: integral values are equal exactly when their bytes are,
+  // floating point values need IEEE comparisons, anything else goes
+  // through the element operators.
+  struct __compare_generic { };
+  struct __compare_bytes { };
+  struct __compare_floating { };
+
+  template <class T, bool = is_integral<T>::value, bool = is_floating_point<T>::value>
+  struct __compare_kind { typedef __compare_generic type; };
+
+  template <class T>
+  struct __compare_kind<T, true, false> { typedef __compare_bytes type; };
+
+  template <class T>
+  struct __compare_kind<T, false, true> { typedef __compare_floating type; };
+
+  template <class T>
+  bool __contiguous_equal(const T *a, const T *b, std::size_t n, __compare_generic)
+  {
+    return std::equal(a, a + n, b);
+  }
+
+  template <class T>
+  bool __contiguous_equal(const T *a, const T *b, std::size_t n, __compare_bytes)
+  {
+    return std::memcmp(a, b, n * sizeof(T)) == 0;
+  }
+
+  template <class T>
+  bool __contiguous_equal(const T *a, const T *b, std::size_t n, __compare_floating)
+  {
+    return mismatch_elements(a, b, n) == n;
+  }
+
+  /// Whether [a, a + n) and [b, b + n) hold equal elements.
+  template <class T>
+  bool contiguous_equal(const T *a, const T *b, std::size_t n)
+  {
+    if (n == 0)
+      return true;
+    return __contiguous_equal(a, b, n, typename __compare_kind<T>::type());
+  }
+
+  template <class T>
+  bool __contiguous_less(const T *a, std::size_t n, const T *b, std::size_t m, __compare_generic)
+  {
+    return std::lexicographical_compare(a, a + n, b, b + m);
+  }
+
+  template <class T>
+  bool __contiguous_less(const T *a, std::size_t n, const T *b, std::size_t m, __compare_bytes)
+  {
+    const std::size_t common = std::min(n, m);
+    const std::size_t i = mismatch_bytes(a, b, common * sizeof(T)) / sizeof(T);
+    if (i == common)
+      return n < m;
+    return a[i] < b[i];
+  }
+
+  template <class T>
+  bool __contiguous_less(const T *a, std::size_t n, const T *b, std::size_t m, __compare_floating)
+  {
+    const std::size_t common = std::min(n, m);
+    std::size_t i = 0;
+    while ((i += mismatch_elements(a + i, b + i, common - i)) != common)
+    {
+      if (a[i] < b[i])
+        return true;
+      if (b[i] < a[i])
+        return false;
+      // Unordered (NaN): neither is less, keep scanning.
+      ++i;
+    }
+    return n < m;
+  }
+
+  /// std::lexicographical_compare over [a, a + n) and [b, b + m).
+  template <class T>
+  bool contiguous_less(const T *a, std::size_t n, const T *b, std::size_t m)
+  {
+    if (n == 0 || m == 0)
+      return n < m;
+    return __contiguous_less(a, n, b, m, typename __compare_kind<T>::type());
+  }
+
+}
+
+#endif
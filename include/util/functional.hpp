@@ -0,0 +1,84 @@
+#ifndef FUNCTIONAL_HPP
+#define FUNCTIONAL_HPP
+
+namespace ft
+{
+
+  // Key extractors: rb_tree orders its values by KeyOfValue()(value), so
+  // that map compares only the keys of its pairs instead of whole values.
+
+  /// identity
+  template <class T>
+  struct identity
+  {
+    typedef T argument_type;
+
+    typedef T result_type;
+
+    const T &operator()(const T &value) const { return value; }
+  };
+
+  /// select_first
+  template <class Pair>
+  struct select_first
+  {
+    typedef Pair argument_type;
+
+    typedef typename Pair::first_type result_type;
+
+    const result_type &operator()(const Pair &value) const { return value.first; }
+  };
+
+  /// less: same as std::less for a given T.
+  template <class T = void>
+  struct less
+  {
+    typedef T first_argument_type;
+
+    typedef T second_argument_type;
+
+    typedef bool result_type;
+
+    bool operator()(const T &lhs, const T &rhs) const { return lhs < rhs; }
+  };
+
+  /**
+   * @brief Transparent comparator: compares any two operands with @c <, so
+   * that rb_tree lookups accept keys of another type (a string literal for
+   * a tree of std::string) without building a temporary key_type.
+   */
+  template <>
+  struct less<void>
+  {
+    typedef void is_transparent;
+
+    template <class T, class U>
+    bool operator()(const T &lhs, const U &rhs) const { return lhs < rhs; }
+  };
+
+  /// equal_to: same as std::equal_to for a given T.
+  template <class T = void>
+  struct equal_to
+  {
+    typedef T first_argument_type;
+
+    typedef T second_argument_type;
+
+    typedef bool result_type;
+
+    bool operator()(const T &lhs, const T &rhs) const { return lhs == rhs; }
+  };
+
+  /// Transparent equality, the hashed containers' counterpart of less<void>.
+  template <>
+  struct equal_to<void>
+  {
+    typedef void is_transparent;
+
+    template <class T, class U>
+    bool operator()(const T &lhs, const U &rhs) const { return lhs == rhs; }
+  };
+
+}
+
+#endif
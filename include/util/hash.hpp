@@ -0,0 +1,93 @@
+#ifndef HASH_HPP
+# define HASH_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <string>
+
+namespace ft
+{
+
+  // Hash functions for the hashed and sharded containers. Unlike most
+  // std::hash implementations, integers are not hashed to themselves: the
+  // result goes through a 64-bit finalizer (MurmurHash3's fmix64) so that
+  // every output bit depends on every input bit, and taking the low bits
+  // or a modulo of it spreads sequential keys evenly.
+
+  inline std::size_t __hash_mix(unsigned long long x)
+  {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return static_cast<std::size_t>(x);
+  }
+
+  /// FNV-1a over @c n bytes, then mixed.
+  inline std::size_t __hash_bytes(const void *data, std::size_t n)
+  {
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    unsigned long long h = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      h ^= bytes[i];
+      h *= 0x100000001b3ULL;
+    }
+    return __hash_mix(h);
+  }
+
+  /// Integral, enum and pointer keys; other key types need a specialization
+  /// or their own functor.
+  template <class T>
+  struct hash
+  {
+    typedef T argument_type;
+
+    typedef std::size_t result_type;
+
+    std::size_t operator()(const T &value) const
+    {
+      return __hash_mix(static_cast<unsigned long long>(value));
+    }
+  };
+
+  template <class T>
+  struct hash<T *>
+  {
+    typedef T *argument_type;
+
+    typedef std::size_t result_type;
+
+    std::size_t operator()(T *value) const
+    {
+      return __hash_mix(reinterpret_cast<std::size_t>(value));
+    }
+  };
+
+  /// Transparent: C strings hash like the equal std::string, so that a
+  /// hashed container with a transparent key_equal is searched without
+  /// building a temporary string.
+  template <>
+  struct hash<std::string>
+  {
+    typedef std::string argument_type;
+
+    typedef std::size_t result_type;
+
+    typedef void is_transparent;
+
+    std::size_t operator()(const std::string &value) const
+    {
+      return __hash_bytes(value.data(), value.size());
+    }
+
+    std::size_t operator()(const char *value) const
+    {
+      return __hash_bytes(value, std::strlen(value));
+    }
+  };
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef PAIR_HPP
+#define PAIR_HPP
+
+namespace ft
+{
+
+  /**
+   * @brief Couples two values, possibly of different types. This is the
+   * value_type of ft::map and ft::multimap.
+   *
+   * @see https://en.cppreference.com/w/cpp/utility/pair
+   */
+  template <class T1, class T2>
+  struct pair
+  {
+    typedef T1 first_type;
+
+    typedef T2 second_type;
+
+    T1 first;
+
+    T2 second;
+
+    pair() : first(), second() {}
+
+    pair(const T1 &a, const T2 &b) : first(a), second(b) {}
+
+    pair(const pair &other) : first(other.first), second(other.second) {}
+
+    template <class U1, class U2>
+    pair(const pair<U1, U2> &other) : first(other.first), second(other.second) {}
+
+    pair &operator=(const pair &other)
+    {
+      first = other.first;
+      second = other.second;
+      return *this;
+    }
+
+#if __cplusplus >= 201103L
+    // The copy operations above would otherwise suppress the implicit
+    // moves, and relocation would copy every pair.
+    pair(pair &&) = default;
+
+    pair &operator=(pair &&) = default;
+#endif
+  };
+
+  template <class T1, class T2>
+  bool operator==(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+  { return lhs.first == rhs.first && lhs.second == rhs.second; }
+
+  template <class T1, class T2>
+  bool operator!=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+  { return !(lhs == rhs); }
+
+  template <class T1, class T2>
+  bool operator<(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+  { return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second); }
+
+  template <class T1, class T2>
+  bool operator<=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+  { return !(rhs < lhs); }
+
+  template <class T1, class T2>
+  bool operator>(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+  { return rhs < lhs; }
+
+  template <class T1, class T2>
+  bool operator>=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+  { return !(lhs < rhs); }
+
+  template <class T1, class T2>
+  pair<T1, T2> make_pair(T1 first, T2 second)
+  { return pair<T1, T2>(first, second); }
+
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define TYPE_TRAITS_HPP
 
 #include <iterator>
+#include <cstddef>
 
 namespace ft
 {
@@ -86,6 +87,88 @@ namespace ft
   struct is_integral :
     public __is_integral_helper<typename remove_cv<_Tp>::type>::type { };
 
+  template <typename>
+  struct __is_floating_point_helper : public false_type { };
+
+  template <>
+  struct __is_floating_point_helper<float> : public true_type { };
+
+  template <>
+  struct __is_floating_point_helper<double> : public true_type { };
+
+  template <>
+  struct __is_floating_point_helper<long double> : public true_type { };
+
+  /// is_floating_point
+  template <typename _Tp>
+  struct is_floating_point :
+    public __is_floating_point_helper<typename remove_cv<_Tp>::type>::type { };
+
+  /// is_arithmetic
+  template <typename _Tp>
+  struct is_arithmetic :
+    public integral_constant<bool, (is_integral<_Tp>::value || is_floating_point<_Tp>::value)> { };
+
+  template <typename>
+  struct __is_pointer_helper : public false_type { };
+
+  template <typename _Tp>
+  struct __is_pointer_helper<_Tp *> : public true_type { };
+
+  /// is_pointer
+  template <typename _Tp>
+  struct is_pointer :
+    public __is_pointer_helper<typename remove_cv<_Tp>::type>::type { };
+
+  /// is_same
+  template <typename _Tp, typename _Up>
+  struct is_same : public false_type { };
+
+  template <typename _Tp>
+  struct is_same<_Tp, _Tp> : public true_type { };
+
+#if defined(__GNUC__) || defined(__clang__)
+# define FT_IS_ENUM(_Tp) __is_enum(_Tp)
+# define FT_IS_TRIVIALLY_COPYABLE(_Tp) __is_trivially_copyable(_Tp)
+#else
+# define FT_IS_ENUM(_Tp) false
+# define FT_IS_TRIVIALLY_COPYABLE(_Tp) false
+#endif
+
+  /// is_enum
+  template <typename _Tp>
+  struct is_enum : public integral_constant<bool, FT_IS_ENUM(_Tp)> { };
+
+  /// is_scalar
+  template <typename _Tp>
+  struct is_scalar :
+    public integral_constant<bool, (is_arithmetic<_Tp>::value || is_pointer<_Tp>::value || is_enum<_Tp>::value)> { };
+
+  /**
+   * @brief Whether objects of @c _Tp may be copied, relocated and destroyed
+   * as raw bytes (memcpy / memmove, no destructor call).
+   *
+   * Scalars always qualify; class types are detected through the compiler
+   * intrinsic when one is available. A user type the compiler cannot prove
+   * trivial (e.g. one with an empty user-declared copy constructor) may opt
+   * in by specializing this template to derive from @c true_type.
+   */
+  template <typename _Tp>
+  struct is_trivially_copyable :
+    public integral_constant<bool, (is_scalar<_Tp>::value || FT_IS_TRIVIALLY_COPYABLE(_Tp))> { };
+
+  template <typename _Tp>
+  struct __alignment_of_helper
+  {
+    char __c;
+    _Tp __t;
+  };
+
+  /// alignment_of
+  template <typename _Tp>
+  struct alignment_of :
+    public integral_constant<std::size_t, sizeof(__alignment_of_helper<_Tp>) - sizeof(_Tp)> { };
+
   // Primary template.
   /// Define a member typedef @c type only if a boolean constant is true.
   template<bool, typename _Tp = void>
@@ -95,6 +178,26 @@ namespace ft
   template<typename _Tp>
   struct enable_if<true, _Tp> { typedef _Tp type; };
 
+  /**
+   * @brief Whether the comparator declares a nested @c is_transparent type,
+   * i.e. accepts any pair of argument types (heterogeneous lookup). The
+   * unused second parameter lets member templates make the test depend on
+   * their own arguments, so that it is a substitution failure.
+   */
+  template<typename _Compare, typename = void>
+  struct has_is_transparent
+  {
+  private:
+    template<typename _Up>
+      static char __test(typename _Up::is_transparent *);
+
+    template<typename _Up>
+      static long __test(...);
+
+  public:
+    static const bool value = sizeof(__test<_Compare>(0)) == 1;
+  };
+
 }
 
 #endif
@@ -0,0 +1,129 @@
+#include "test_container.hpp"
+#include "container/concurrent_stack.hpp"
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+TEST(concurrent_stack, lifo_single_thread)
+{
+    ft::concurrent_stack<std::string> s;
+    std::string out;
+
+    ASSERT(s.empty() && !s.try_pop(out))
+
+    for (int i = 0; i < 1000; ++i)
+        s.push(std::string(i % 50 + 20, 'a' + i % 26));
+
+    bool ok = !s.empty();
+    for (int i = 999; i >= 0; --i)
+        ok = ok && s.try_pop(out) && out == std::string(i % 50 + 20, 'a' + i % 26);
+
+    ASSERT(ok && s.empty() && !s.try_pop(out))
+
+    for (int i = 0; i < 10; ++i)
+        s.push("left behind");
+}
+
+namespace
+{
+    // Assignment throws while `fail` is set.
+    struct throwing_assign
+    {
+        static bool fail;
+        int value;
+
+        throwing_assign(int v = 0) : value(v) {}
+
+        throwing_assign(const throwing_assign &other) : value(other.value) {}
+
+        throwing_assign &operator=(const throwing_assign &other)
+        {
+            if (fail)
+                throw std::runtime_error("throwing_assign");
+            value = other.value;
+            return *this;
+        }
+    };
+
+    bool throwing_assign::fail = false;
+}
+
+TEST(concurrent_stack, try_pop_throwing_assign)
+{
+    ft::concurrent_stack<throwing_assign> s;
+    throwing_assign out;
+    bool thrown = false;
+
+    s.push(throwing_assign(1));
+    s.push(throwing_assign(2));
+    throwing_assign::fail = true;
+    try
+    {
+        s.try_pop(out);
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    throwing_assign::fail = false;
+
+    ASSERT(thrown && out.value == 0)
+    ASSERT(s.try_pop(out) && out.value == 2)
+    ASSERT(s.try_pop(out) && out.value == 1 && s.empty())
+}
+
+namespace
+{
+    const int stress_threads = 8;
+    const int stress_items = 20000;
+
+    struct stress_context
+    {
+        ft::concurrent_stack<int> *stack;
+        int thread;
+        std::vector<int> popped;
+    };
+
+    void *stress_worker(void *argument)
+    {
+        stress_context *context = static_cast<stress_context *>(argument);
+        int value;
+        for (int i = 0; i < stress_items; ++i)
+        {
+            context->stack->push(context->thread * stress_items + i);
+            if (i % 3 != 0 && context->stack->try_pop(value))
+                context->popped.push_back(value);
+        }
+        return NULL;
+    }
+}
+
+TEST(concurrent_stack, stress_every_item_popped_once)
+{
+    ft::concurrent_stack<int> s;
+    stress_context contexts[stress_threads];
+    pthread_t threads[stress_threads];
+
+    for (int t = 0; t < stress_threads; ++t)
+    {
+        contexts[t].stack = &s;
+        contexts[t].thread = t;
+        pthread_create(&threads[t], NULL, stress_worker, &contexts[t]);
+    }
+    for (int t = 0; t < stress_threads; ++t)
+        pthread_join(threads[t], NULL);
+
+    std::vector<int> seen(stress_threads * stress_items, 0);
+    for (int t = 0; t < stress_threads; ++t)
+        for (size_t i = 0; i < contexts[t].popped.size(); ++i)
+            ++seen[contexts[t].popped[i]];
+    int value;
+    while (s.try_pop(value))
+        ++seen[value];
+
+    bool ok = true;
+    for (size_t i = 0; i < seen.size(); ++i)
+        ok = ok && seen[i] == 1;
+
+    ASSERT(ok && s.empty())
+}
@@ -0,0 +1,204 @@
+#include "test_container.hpp"
+#include "container/deque.hpp"
+#include "container/stack.hpp"
+#include <deque>
+#include <stack>
+
+TEST(deque, constructor_default)
+{
+    NS::deque<int> d;
+
+    ASSERT(d.empty())
+    ASSERT(d.size() == 0)
+    ASSERT(d.begin() == d.end())
+}
+
+TEST(deque, constructor_fill_and_copy)
+{
+    NS::deque<int> d(5000, 42);
+    NS::deque<int> copy(d);
+
+    ASSERT(d.size() == 5000)
+    ASSERT(copy == d)
+    ASSERT(copy.front() == 42 && copy.back() == 42)
+}
+
+TEST(deque, push_back_and_front_across_chunks)
+{
+    NS::deque<int> d;
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        d.push_back(i);
+        d.push_front(-i);
+    }
+
+    ASSERT(d.size() == 20000)
+    ASSERT(d.front() == -9999)
+    ASSERT(d.back() == 9999)
+    ASSERT(d[10000] == 0)
+    ASSERT(d.at(19999) == 9999)
+    ASSERT(d.end() - d.begin() == 20000)
+
+    // push_front(-i) gives -9999 .. 0, push_back(i) gives 0 .. 9999.
+    bool ordered = true;
+    int index = 0;
+    for (NS::deque<int>::const_iterator it = d.begin(); it != d.end(); ++it, ++index)
+        ordered = ordered && *it == (index < 10000 ? index - 9999 : index - 10000);
+    ASSERT(ordered)
+}
+
+TEST(deque, pop_back_and_front)
+{
+    NS::deque<int> d;
+
+    for (int i = 0; i < 5000; ++i)
+        d.push_back(i);
+    for (int i = 0; i < 2000; ++i)
+    {
+        d.pop_back();
+        d.pop_front();
+    }
+
+    ASSERT(d.size() == 1000)
+    ASSERT(d.front() == 2000)
+    ASSERT(d.back() == 2999)
+
+    while (!d.empty())
+        d.pop_front();
+    d.push_back(7);
+
+    ASSERT(d.size() == 1 && d.front() == 7 && d.back() == 7)
+}
+
+TEST(deque, stable_addresses)
+{
+    NS::deque<int> d;
+
+    d.push_back(1);
+    const int *first = &d.front();
+    for (int i = 0; i < 100000; ++i)
+    {
+        d.push_back(i);
+        d.push_front(i);
+    }
+
+    ASSERT(first == &d[100000])
+    ASSERT(*first == 1)
+}
+
+TEST(deque, iterator_arithmetic)
+{
+    NS::deque<int> d;
+
+    for (int i = 0; i < 3000; ++i)
+        d.push_back(i);
+
+    NS::deque<int>::iterator it = d.begin() + 2500;
+
+    ASSERT(*it == 2500)
+    ASSERT(*(it - 2400) == 100)
+    ASSERT(it[-2500] == 0)
+    ASSERT(d.end() - it == 500)
+    ASSERT(d.begin() < it && it < d.end())
+    ASSERT(*d.rbegin() == 2999)
+    ASSERT(*(d.rend() - 1) == 0)
+}
+
+TEST(deque, resize_assign_clear)
+{
+    NS::deque<int> d;
+
+    d.resize(3000, 5);
+    ASSERT(d.size() == 3000 && d.back() == 5)
+
+    d.resize(10);
+    ASSERT(d.size() == 10)
+
+    d.assign(4, 9);
+    ASSERT(d.size() == 4 && d.front() == 9)
+
+    d.clear();
+    ASSERT(d.empty())
+    d.push_front(3);
+    ASSERT(d.front() == 3)
+}
+
+TEST(deque, compare_and_swap)
+{
+    NS::deque<int> a(3, 1);
+    NS::deque<int> b(3, 2);
+
+    ASSERT(a < b)
+    ASSERT(a != b)
+
+    a.swap(b);
+
+    ASSERT(a.front() == 2)
+    ASSERT(!(b > a))
+}
+
+#if __cplusplus >= 201103L
+namespace
+{
+    // Construction throws while `fail` is set.
+    struct throwing_ctor
+    {
+        static bool fail;
+        int value;
+
+        explicit throwing_ctor(int v) : value(v)
+        {
+            if (fail)
+                throw std::runtime_error("throwing_ctor");
+        }
+    };
+
+    bool throwing_ctor::fail = false;
+}
+
+TEST(deque, emplace_strong_guarantee)
+{
+    NS::deque<throwing_ctor> d;
+    int thrown = 0;
+
+    // Every other emplace throws, so some of them throw at a chunk boundary.
+    for (int i = 0; i < 5000; ++i)
+    {
+        throwing_ctor::fail = i % 2 != 0;
+        try
+        {
+            if (i % 4 < 2)
+                d.emplace_back(i);
+            else
+                d.emplace_front(i);
+        }
+        catch (const std::runtime_error &)
+        {
+            ++thrown;
+        }
+    }
+    throwing_ctor::fail = false;
+
+    ASSERT(thrown == 2500 && d.size() == 2500)
+    ASSERT(d.front().value == 4998 && d.back().value == 4996)
+    d.emplace_back(-1);
+    ASSERT(d.size() == 2501 && d.back().value == -1)
+}
+#endif
+
+TEST(deque, stack_container)
+{
+    NS::stack<int, NS::deque<int> > s;
+
+    for (int i = 0; i < 10000; ++i)
+        s.push(i);
+
+    ASSERT(s.size() == 10000)
+    ASSERT(s.top() == 9999)
+
+    for (int i = 0; i < 5000; ++i)
+        s.pop();
+
+    ASSERT(s.top() == 4999)
+}
@@ -0,0 +1,67 @@
+#include "test_container.hpp"
+#include "container/flat_map.hpp"
+#include <string>
+
+TEST(flat_map, subscript_and_at)
+{
+    ft::flat_map<std::string, int> m;
+
+    m["b"] = 2;
+    m["a"] = 1;
+    m["c"] += 3;
+    m["a"] += 10;
+
+    ASSERT(m.size() == 3 && m.at("a") == 11 && m["c"] == 3)
+    ASSERT(m.begin()->first == "a" && m.rbegin()->first == "c")
+
+    bool thrown = false;
+    try
+    {
+        m.at("z");
+    }
+    catch (const std::out_of_range &)
+    {
+        thrown = true;
+    }
+    ASSERT(thrown)
+}
+
+TEST(flat_map, bulk_insert_keeps_first_value)
+{
+    ft::vector<ft::pair<int, int> > values;
+
+    for (int i = 0; i < 100; ++i)
+        values.push_back(ft::make_pair(99 - i, i));
+    values.push_back(ft::make_pair(50, -1));
+
+    ft::flat_map<int, int> m;
+    m[50] = 1000;
+    m.insert(values.begin(), values.end());
+
+    ASSERT(m.size() == 100 && m[50] == 1000 && m[0] == 99 && m[99] == 0)
+
+    int previous = -1;
+    bool sorted = true;
+    for (ft::flat_map<int, int>::const_iterator it = m.begin(); it != m.end(); ++it)
+    {
+        sorted = sorted && it->first > previous;
+        previous = it->first;
+    }
+    ASSERT(sorted)
+}
+
+TEST(flat_map, erase_and_equal_range)
+{
+    ft::flat_map<int, char> m;
+
+    for (int i = 0; i < 10; ++i)
+        m.insert(ft::make_pair(i, static_cast<char>('a' + i)));
+
+    ASSERT(m.erase(3) == 1 && m.count(3) == 0)
+    ASSERT(m.equal_range(3).first == m.equal_range(3).second)
+    ASSERT(m.equal_range(4).first->second == 'e')
+
+    m.erase(m.find(5), m.end());
+
+    ASSERT(m.size() == 4 && m.rbegin()->first == 4)
+}
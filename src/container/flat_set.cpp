@@ -0,0 +1,75 @@
+#include "test_container.hpp"
+#include "container/flat_set.hpp"
+#include <string>
+
+TEST(flat_set, insert_find_erase)
+{
+    ft::flat_set<int> s;
+
+    ASSERT(s.empty() && s.find(3) == s.end())
+
+    ASSERT(s.insert(5).second && s.insert(1).second && s.insert(3).second)
+    ASSERT(!s.insert(3).second && s.size() == 3)
+    ASSERT(*s.begin() == 1 && *s.rbegin() == 5)
+    ASSERT(*s.find(3) == 3 && s.count(4) == 0)
+    ASSERT(*s.lower_bound(2) == 3 && *s.upper_bound(3) == 5 && s.upper_bound(5) == s.end())
+
+    ASSERT(s.erase(1) == 1 && s.erase(1) == 0)
+    ASSERT(*s.erase(s.begin()) == 5 && s.size() == 1)
+}
+
+TEST(flat_set, bulk_insert_merges_and_dedups)
+{
+    int first[] = {9, 3, 7, 3, 1};
+    int second[] = {4, 9, 0, 4, 12, 2};
+
+    ft::flat_set<int> s(first, first + 5);
+
+    ASSERT(s.size() == 4)
+
+    s.insert(second, second + 6);
+
+    int expected[] = {0, 1, 2, 3, 4, 7, 9, 12};
+
+    ASSERT(s.size() == 8 && std::equal(s.begin(), s.end(), expected))
+}
+
+TEST(flat_set, lookups_match_linear_scan)
+{
+    ft::flat_set<int> s;
+
+    for (int i = 0; i < 1000; ++i)
+        s.insert((i * 7919) % 2000);
+
+    bool ok = s.size() == 1000;
+    for (int k = -1; k <= 2001; ++k)
+    {
+        ft::flat_set<int>::iterator it = s.begin();
+        while (it != s.end() && *it < k)
+            ++it;
+        ok = ok && s.lower_bound(k) == it;
+        while (it != s.end() && *it <= k)
+            ++it;
+        ok = ok && s.upper_bound(k) == it;
+    }
+    ASSERT(ok)
+}
+
+TEST(flat_set, hint_and_comparison)
+{
+    ft::flat_set<std::string> a;
+    ft::flat_set<std::string> b;
+
+    a.insert(a.end(), "alpha");
+    a.insert(a.end(), "beta");
+    a.insert(a.begin(), "gamma");
+    b.insert("alpha");
+    b.insert("beta");
+
+    ASSERT(a.size() == 3 && *a.rbegin() == "gamma")
+    ASSERT(b < a && a != b)
+
+    b.insert("gamma");
+
+    ASSERT(a == b)
+}
@@ -0,0 +1,91 @@
+#include "test_container.hpp"
+#include "container/vector.hpp"
+
+#include <cstdlib>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+TEST(growth_policy, doubling)
+{
+    ft::vector<int> v;
+
+    v.push_back(1);
+    ASSERT(v.capacity() == 1)
+    v.push_back(2);
+    ASSERT(v.capacity() == 2)
+    v.push_back(3);
+    ASSERT(v.capacity() == 4)
+    ASSERT(ft::doubling_growth::next_capacity(8, 30, 4, 100) == 30)
+    ASSERT(ft::doubling_growth::next_capacity(80, 81, 4, 100) == 100)
+}
+
+TEST(growth_policy, half)
+{
+    ft::vector<int, std::allocator<int>, ft::half_growth> v;
+    std::size_t last = 0;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+        if (v.capacity() != last)
+        {
+            ASSERT(last == 0 || v.capacity() == last + (last > 1 ? last / 2 : 1))
+            last = v.capacity();
+        }
+    }
+    ASSERT(v.size() == 1000 && v[999] == 999)
+    ASSERT(v.capacity() < 1500)
+}
+
+TEST(growth_policy, chunked_fills_size_class)
+{
+    typedef ft::chunked_growth<> policy;
+
+    // 36 bytes plus the 16-byte header round up to a 64-byte chunk.
+    ASSERT(policy::next_capacity(0, 3, 12, 1000) == 4)
+    // 5000 bytes of doubles round up to two pages, less the header.
+    ASSERT(policy::next_capacity(0, 625, 8, 10000) == (8192 - 3 * sizeof(std::size_t)) / 8)
+
+    ft::vector<char, std::allocator<char>, policy> v;
+
+    v.push_back('a');
+    ASSERT(v.capacity() == 16)
+    v.insert(v.end(), 20, 'b');
+    ASSERT(v.size() == 21 && v.capacity() == 32)
+    ASSERT(v[0] == 'a' && v[20] == 'b')
+}
+
+#if defined(__GLIBC__)
+TEST(growth_policy, chunked_matches_malloc_usable_size)
+{
+    typedef ft::chunked_growth<> policy;
+    const std::size_t sizes[] = {1, 8, 12, 16, 24};
+
+    // Whether malloc serves the block from the heap or with mmap, what it
+    // hands out holds the buffer with less than one more element to spare,
+    // beyond a reused chunk's unsplittable tail (under its 4-word minimum
+    // chunk size).
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+        for (std::size_t required = 1; required < 100000; required = required * 3 + 1)
+        {
+            const std::size_t bytes = policy::next_capacity(0, required, sizes[s], static_cast<std::size_t>(-1)) * sizes[s];
+            void *p = std::malloc(bytes);
+            const std::size_t usable = malloc_usable_size(p);
+            std::free(p);
+            ASSERT(usable >= bytes)
+            ASSERT(usable - bytes < sizes[s] + 4 * sizeof(std::size_t))
+        }
+}
+#endif
+
+TEST(growth_policy, comparison_and_swap)
+{
+    ft::vector<int, std::allocator<int>, ft::half_growth> a(3, 1);
+    ft::vector<int, std::allocator<int>, ft::half_growth> b(2, 2);
+
+    ASSERT(a < b && a != b)
+    ft::swap(a, b);
+    ASSERT(a.size() == 2 && b.size() == 3)
+}
@@ -0,0 +1,202 @@
+#include "test_container.hpp"
+#include "container/map.hpp"
+#include <map>
+#include <string>
+
+TEST(map, constructor_empty)
+{
+    NS::map<int, int> m;
+
+    ASSERT(m.empty())
+    ASSERT(m.size() == 0)
+    ASSERT(m.begin() == m.end())
+}
+
+TEST(map, constructor_range)
+{
+    NS::pair<int, int> arr[] = {NS::make_pair(3, 30), NS::make_pair(1, 10), NS::make_pair(2, 20), NS::make_pair(1, 99)};
+
+    NS::map<int, int> m(arr, arr + 4);
+
+    ASSERT(m.size() == 3)
+    ASSERT(m[1] == 10)
+    ASSERT(m[2] == 20)
+    ASSERT(m[3] == 30)
+}
+
+TEST(map, constructor_copy)
+{
+    NS::map<int, std::string> m;
+
+    m[1] = "one";
+    m[2] = "two";
+
+    NS::map<int, std::string> copy(m);
+
+    m[1] = "uno";
+
+    ASSERT(copy.size() == 2)
+    ASSERT(copy[1] == "one")
+    ASSERT(copy[2] == "two")
+}
+
+TEST(map, insert)
+{
+    NS::map<int, int> m;
+
+    NS::pair<NS::map<int, int>::iterator, bool> first = m.insert(NS::make_pair(1, 10));
+    NS::pair<NS::map<int, int>::iterator, bool> second = m.insert(NS::make_pair(1, 20));
+
+    ASSERT(first.second)
+    ASSERT(!second.second)
+    ASSERT(first.first == second.first)
+    ASSERT(second.first->second == 10)
+    ASSERT(m.size() == 1)
+}
+
+TEST(map, insert_hint_sorted)
+{
+    NS::map<int, int> m;
+
+    for (int index = 0; index < 1000; ++index)
+        m.insert(m.end(), NS::make_pair(index, index * 2));
+
+    ASSERT(m.size() == 1000)
+
+    int index = 0;
+    for (NS::map<int, int>::iterator it = m.begin(); it != m.end(); ++it, ++index)
+        ASSERT(it->first == index && it->second == index * 2)
+}
+
+TEST(map, insert_hint_wrong)
+{
+    NS::map<int, int> m;
+
+    for (int index = 0; index < 100; index += 2)
+        m.insert(NS::make_pair(index, index));
+
+    NS::map<int, int>::iterator it = m.insert(m.begin(), NS::make_pair(51, 51));
+    m.insert(m.find(10), NS::make_pair(11, 11));
+    m.insert(m.find(10), NS::make_pair(10, 99));
+
+    ASSERT(it->first == 51)
+    ASSERT(m.size() == 52)
+    ASSERT(m[10] == 10)
+    ASSERT((--m.find(51))->first == 50)
+    ASSERT((++m.find(11))->first == 12)
+}
+
+TEST(map, operator_bracket)
+{
+    NS::map<std::string, int> m;
+
+    m["b"] = 2;
+    m["a"] = 1;
+    ++m["b"];
+
+    ASSERT(m.size() == 2)
+    ASSERT(m["a"] == 1)
+    ASSERT(m["b"] == 3)
+    ASSERT(m["c"] == 0)
+    ASSERT(m.size() == 3)
+}
+
+TEST(map, erase_iterator)
+{
+    NS::map<int, int> m;
+
+    for (int index = 0; index < 10; ++index)
+        m[index] = index;
+
+    m.erase(m.find(3));
+    m.erase(m.begin());
+
+    ASSERT(m.size() == 8)
+    ASSERT(m.find(3) == m.end())
+    ASSERT(m.begin()->first == 1)
+}
+
+TEST(map, erase_key_and_range)
+{
+    NS::map<int, int> m;
+
+    for (int index = 0; index < 10; ++index)
+        m[index] = index;
+
+    ASSERT(m.erase(5) == 1)
+    ASSERT(m.erase(5) == 0)
+
+    m.erase(m.find(7), m.end());
+
+    ASSERT(m.size() == 6)
+    ASSERT((--m.end())->first == 6)
+}
+
+TEST(map, bounds)
+{
+    NS::map<int, int> m;
+
+    for (int index = 0; index < 10; index += 2)
+        m[index] = index;
+
+    ASSERT(m.lower_bound(4)->first == 4)
+    ASSERT(m.lower_bound(5)->first == 6)
+    ASSERT(m.upper_bound(4)->first == 6)
+    ASSERT(m.upper_bound(8) == m.end())
+    ASSERT(m.equal_range(6).first->first == 6)
+    ASSERT(m.equal_range(6).second->first == 8)
+    ASSERT(m.count(6) == 1)
+    ASSERT(m.count(7) == 0)
+}
+
+TEST(map, reverse_iterator)
+{
+    NS::map<int, int> m;
+
+    for (int index = 0; index < 10; ++index)
+        m[index] = index;
+
+    int index = 9;
+    for (NS::map<int, int>::reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+        ASSERT(it->first == index--)
+}
+
+TEST(map, swap_and_compare)
+{
+    NS::map<int, int> a;
+    NS::map<int, int> b;
+
+    a[1] = 1;
+    b[1] = 1;
+    b[2] = 2;
+
+    ASSERT(a < b)
+    ASSERT(a != b)
+
+    a.swap(b);
+
+    ASSERT(a.size() == 2)
+    ASSERT(b.size() == 1)
+    ASSERT(b < a)
+}
+
+TEST(multimap, insert_equal_keys)
+{
+    NS::multimap<int, int> m;
+
+    m.insert(NS::make_pair(1, 1));
+    m.insert(NS::make_pair(2, 2));
+    m.insert(NS::make_pair(1, 3));
+    m.insert(m.end(), NS::make_pair(1, 4));
+
+    ASSERT(m.size() == 4)
+    ASSERT(m.count(1) == 3)
+
+    int expected[] = {1, 3, 4};
+    int index = 0;
+    for (NS::multimap<int, int>::iterator it = m.lower_bound(1); it != m.upper_bound(1); ++it)
+        ASSERT(it->second == expected[index++])
+
+    ASSERT(m.erase(1) == 3)
+    ASSERT(m.size() == 1)
+}
@@ -0,0 +1,109 @@
+#include "test_container.hpp"
+#include "container/set.hpp"
+#include <set>
+
+TEST(set, constructor_empty)
+{
+    NS::set<int> s;
+
+    ASSERT(s.empty())
+    ASSERT(s.begin() == s.end())
+}
+
+TEST(set, constructor_range)
+{
+    int arr[] = {5, 3, 5, 1, 3};
+
+    NS::set<int> s(arr, arr + 5);
+
+    ASSERT(s.size() == 3)
+    ASSERT(*s.begin() == 1)
+    ASSERT(*s.rbegin() == 5)
+}
+
+TEST(set, insert)
+{
+    NS::set<int> s;
+
+    ASSERT(s.insert(1).second)
+    ASSERT(!s.insert(1).second)
+    ASSERT(*s.insert(2).first == 2)
+    ASSERT(s.size() == 2)
+}
+
+TEST(set, insert_hint_sorted)
+{
+    NS::set<int> s;
+
+    for (int index = 0; index < 1000; ++index)
+        s.insert(s.end(), index);
+
+    ASSERT(s.size() == 1000)
+
+    int index = 0;
+    for (NS::set<int>::iterator it = s.begin(); it != s.end(); ++it)
+        ASSERT(*it == index++)
+}
+
+TEST(set, erase)
+{
+    NS::set<int> s;
+
+    for (int index = 0; index < 10; ++index)
+        s.insert(index);
+
+    s.erase(s.find(4));
+
+    ASSERT(s.erase(5) == 1)
+    ASSERT(s.erase(5) == 0)
+
+    s.erase(s.begin(), s.find(3));
+
+    ASSERT(s.size() == 5)
+    ASSERT(*s.begin() == 3)
+}
+
+TEST(set, bounds)
+{
+    NS::set<int> s;
+
+    for (int index = 0; index < 10; index += 2)
+        s.insert(index);
+
+    ASSERT(*s.lower_bound(3) == 4)
+    ASSERT(*s.upper_bound(4) == 6)
+    ASSERT(s.lower_bound(10) == s.end())
+    ASSERT(s.count(2) == 1)
+    ASSERT(s.count(3) == 0)
+}
+
+TEST(set, compare)
+{
+    NS::set<int> a;
+    NS::set<int> b;
+
+    a.insert(1);
+    b.insert(1);
+
+    ASSERT(a == b)
+
+    b.insert(2);
+
+    ASSERT(a < b)
+    ASSERT(b > a)
+}
+
+TEST(multiset, insert_equal)
+{
+    NS::multiset<int> s;
+
+    s.insert(2);
+    s.insert(1);
+    s.insert(2);
+    s.insert(s.begin(), 2);
+
+    ASSERT(s.size() == 4)
+    ASSERT(s.count(2) == 3)
+    ASSERT(s.erase(2) == 3)
+    ASSERT(s.size() == 1)
+}
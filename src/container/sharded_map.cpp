@@ -0,0 +1,164 @@
+#include "test_container.hpp"
+#include "container/sharded_map.hpp"
+#include "util/hash.hpp"
+#include <map>
+#include <pthread.h>
+#include <string>
+
+namespace
+{
+    typedef ft::sharded_map<int, int> int_map;
+
+    typedef ft::sharded_map<int, int, std::less<int>, ft::range_partition<int> > range_map;
+
+    // Merged iteration against the expected contents.
+    template <class Map>
+    bool same_contents(const Map &map, const std::map<int, int> &expected)
+    {
+        typename Map::ordered_view view(map);
+        if (view.size() != expected.size())
+            return false;
+        std::map<int, int>::const_iterator it = expected.begin();
+        for (typename Map::ordered_view::const_iterator node = view.begin(); node != view.end(); ++node, ++it)
+            if (it == expected.end() || node->first != it->first || node->second != it->second)
+                return false;
+        return it == expected.end();
+    }
+}
+
+TEST(sharded_map, hash_spreads_sequential_keys)
+{
+    ft::hash<int> hash;
+    std::size_t buckets[16] = {0};
+
+    for (int key = 0; key < 16000; ++key)
+        ++buckets[hash(key) % 16];
+
+    bool even = true;
+    for (int index = 0; index < 16; ++index)
+        even = even && buckets[index] > 800 && buckets[index] < 1200;
+
+    ASSERT(even)
+    ASSERT(ft::hash<std::string>()("shard") == ft::hash<std::string>()(std::string("shard")))
+    ASSERT(ft::hash<std::string>()("shard") != ft::hash<std::string>()("shards"))
+}
+
+TEST(sharded_map, point_operations)
+{
+    int_map map(ft::hash_partition<int>(7));
+    std::map<int, int> expected;
+    unsigned int seed = 7;
+    bool ok = map.shard_count() == 7 && map.empty();
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const int key = static_cast<int>((seed >> 8) % 1000);
+        int value = 0;
+        switch ((seed >> 4) % 4)
+        {
+        case 0:
+            ok = ok && map.erase(key) == expected.erase(key);
+            break;
+        case 1:
+            ok = ok && map.insert(int_map::value_type(key, step)) == expected.insert(std::make_pair(key, step)).second;
+            break;
+        case 2:
+            ok = ok && map.assign(key, step) == (expected.count(key) == 0);
+            expected[key] = step;
+            break;
+        default:
+            ok = ok && map.find(key, value) == (expected.count(key) != 0) && (value == 0 || value == expected[key]);
+            break;
+        }
+    }
+
+    ASSERT(ok)
+    ASSERT(map.size() == expected.size())
+    ASSERT(same_contents(map, expected))
+
+    map.clear();
+
+    ASSERT(map.empty() && map.count(expected.begin()->first) == 0)
+}
+
+TEST(sharded_map, range_partition)
+{
+    const int splits[] = {100, 200, 300};
+    range_map map(ft::range_partition<int>(splits, splits + 3));
+    std::map<int, int> expected;
+
+    ASSERT(map.shard_count() == 4)
+
+    for (int key = 399; key >= -50; key -= 3)
+    {
+        map.insert(range_map::value_type(key, -key));
+        expected[key] = -key;
+    }
+
+    ft::range_partition<int> partition(splits, splits + 3);
+
+    ASSERT(partition(-50) == 0 && partition(99) == 0 && partition(100) == 1 && partition(299) == 2 && partition(300) == 3)
+    ASSERT(same_contents(map, expected))
+}
+
+namespace
+{
+    const int stress_threads = 8;
+    const int stress_keys = 4096;
+
+    struct stress_context
+    {
+        int_map *map;
+        int thread;
+        bool consistent;
+    };
+
+    // Each thread owns the keys congruent to its index, so the final
+    // contents are known, while every thread reads the whole key space.
+    void *stress_worker(void *argument)
+    {
+        stress_context *context = static_cast<stress_context *>(argument);
+        int value;
+        for (int round = 0; round < 4; ++round)
+            for (int key = context->thread; key < stress_keys; key += stress_threads)
+            {
+                context->map->assign(key, key * 2);
+                if (round % 2 == 1 && key % 3 == 0)
+                    context->map->erase(key);
+                if (context->map->find((key * 7) % stress_keys, value))
+                    context->consistent = context->consistent && value == (key * 7) % stress_keys * 2;
+            }
+        return NULL;
+    }
+}
+
+TEST(sharded_map, concurrent_writers)
+{
+    int_map map;
+    pthread_t threads[stress_threads];
+    stress_context contexts[stress_threads];
+
+    for (int index = 0; index < stress_threads; ++index)
+    {
+        contexts[index].map = &map;
+        contexts[index].thread = index;
+        contexts[index].consistent = true;
+        pthread_create(&threads[index], NULL, stress_worker, &contexts[index]);
+    }
+
+    bool consistent = true;
+    for (int index = 0; index < stress_threads; ++index)
+    {
+        pthread_join(threads[index], NULL);
+        consistent = consistent && contexts[index].consistent;
+    }
+
+    std::map<int, int> expected;
+    for (int key = 0; key < stress_keys; ++key)
+        if (key % 3 != 0)
+            expected[key] = key * 2;
+
+    ASSERT(consistent)
+    ASSERT(same_contents(map, expected))
+}
@@ -0,0 +1,207 @@
+#include "test_container.hpp"
+#include "container/small_vector.hpp"
+#include "container/vector.hpp"
+#include "memory/allocator.hpp"
+#include <string>
+
+TEST(small_vector, stays_inline_up_to_n)
+{
+    ft::small_vector<int, 8> v;
+
+    for (int i = 0; i < 8; ++i)
+        v.push_back(i);
+
+    ASSERT(v.is_inline())
+    ASSERT(v.size() == 8)
+    ASSERT(v.capacity() == 8)
+    ASSERT(v.front() == 0 && v.back() == 7)
+}
+
+TEST(small_vector, spills_to_heap)
+{
+    ft::small_vector<std::string, 4> v;
+
+    for (int i = 0; i < 100; ++i)
+        v.push_back(std::string(20, static_cast<char>('a' + i % 26)));
+
+    ASSERT(!v.is_inline())
+    ASSERT(v.size() == 100)
+    ASSERT(v[27] == std::string(20, 'b'))
+    ASSERT(v.at(99) == std::string(20, 'v'))
+
+    v.clear();
+
+    ASSERT(v.empty())
+    ASSERT(v.capacity() >= 100)
+}
+
+TEST(small_vector, shares_vector_iterator)
+{
+    ft::small_vector<int, 4> v;
+    v.push_back(3);
+    v.push_back(1);
+    v.push_back(2);
+
+    ft::vector<int>::iterator first = v.begin();
+    ft::vector<int> copy(first, ft::vector<int>::iterator(v.end()));
+
+    ASSERT(copy.size() == 3)
+    ASSERT(copy[0] == 3 && copy[2] == 2)
+    ASSERT(*v.rbegin() == 2)
+}
+
+TEST(small_vector, insert_erase)
+{
+    ft::small_vector<int, 4> v(2, 0);
+
+    v.insert(v.begin() + 1, 5);
+    v.insert(v.begin(), 2, 7);
+
+    ASSERT(v.is_inline() == false)
+    ASSERT(v.size() == 5)
+    ASSERT(v[0] == 7 && v[1] == 7 && v[2] == 0 && v[3] == 5 && v[4] == 0)
+
+    v.erase(v.begin(), v.begin() + 2);
+
+    ASSERT(v.size() == 3)
+    ASSERT(v[1] == 5)
+
+    int more[] = {8, 9};
+    v.insert(v.end(), more, more + 2);
+
+    ASSERT(v.size() == 5 && v.back() == 9)
+}
+
+TEST(small_vector, copy_assign_swap)
+{
+    ft::small_vector<std::string, 2> inline_v;
+    ft::small_vector<std::string, 2> heap_v;
+
+    inline_v.push_back("a");
+    for (int i = 0; i < 10; ++i)
+        heap_v.push_back("b");
+
+    ft::small_vector<std::string, 2> copy(heap_v);
+    ASSERT(copy == heap_v)
+
+    copy = inline_v;
+    ASSERT(copy == inline_v)
+    ASSERT(copy < heap_v)
+
+    inline_v.swap(heap_v);
+
+    ASSERT(inline_v.size() == 10 && inline_v.front() == "b")
+    ASSERT(heap_v.size() == 1 && heap_v.front() == "a")
+    ASSERT(heap_v.is_inline())
+}
+
+TEST(small_vector, resize_and_reserve)
+{
+    ft::small_vector<int, 16, ft::allocator<int> > v;
+
+    v.resize(10, 4);
+    ASSERT(v.is_inline() && v.size() == 10 && v[9] == 4)
+
+    v.resize(40, 6);
+    ASSERT(!v.is_inline() && v.size() == 40 && v[39] == 6 && v[0] == 4)
+
+    v.resize(3);
+    ASSERT(v.size() == 3)
+
+    v.reserve(1000);
+    ASSERT(v.capacity() == 1000 && v.back() == 4)
+}
+
+namespace
+{
+    // Copying throws once `copies_left` reaches zero; `live` counts the
+    // objects alive so that a leak or a double destroy shows up.
+    struct throwing_copy
+    {
+        static int copies_left;
+        static int live;
+        int value;
+
+        throwing_copy(int v = 0) : value(v) { ++live; }
+
+        throwing_copy(const throwing_copy &other) : value(other.value)
+        {
+            if (copies_left == 0)
+                throw std::runtime_error("throwing_copy");
+            --copies_left;
+            ++live;
+        }
+
+        throwing_copy &operator=(const throwing_copy &other)
+        {
+            value = other.value;
+            return *this;
+        }
+
+        ~throwing_copy() { --live; }
+    };
+
+    int throwing_copy::copies_left = -1;
+    int throwing_copy::live = 0;
+}
+
+TEST(small_vector, spill_strong_guarantee)
+{
+    {
+        ft::small_vector<throwing_copy, 4> v;
+        for (int i = 0; i < 4; ++i)
+            v.push_back(throwing_copy(i));
+
+        // Fail the new element, then each element leaving the inline buffer.
+        for (int fail_at = 0; fail_at <= 4; ++fail_at)
+        {
+            bool thrown = false;
+            throwing_copy::copies_left = fail_at;
+            try
+            {
+                v.insert(v.begin() + 1, throwing_copy(-1));
+            }
+            catch (const std::runtime_error &)
+            {
+                thrown = true;
+            }
+            throwing_copy::copies_left = -1;
+            ASSERT(thrown && v.is_inline() && v.size() == 4)
+            ASSERT(v[0].value == 0 && v[3].value == 3)
+            ASSERT(throwing_copy::live == 4)
+        }
+
+        ft::small_vector<throwing_copy, 4> heap(8, throwing_copy(8));
+        throwing_copy::copies_left = 2;
+        try
+        {
+            v = heap;
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        throwing_copy::copies_left = -1;
+        ASSERT(v.is_inline() && v.size() == 4 && v[2].value == 2)
+    }
+    ASSERT(throwing_copy::live == 0)
+}
+
+#if __cplusplus >= 201103L
+TEST(small_vector, move)
+{
+    ft::small_vector<std::string, 2> inline_v;
+    inline_v.emplace_back(3, 'x');
+
+    ft::small_vector<std::string, 2> moved(std::move(inline_v));
+
+    ASSERT(moved.size() == 1 && moved.front() == "xxx")
+    ASSERT(inline_v.empty())
+
+    ft::small_vector<std::string, 2> heap_v(5, "y");
+    const std::string *data = &heap_v[0];
+    moved = std::move(heap_v);
+
+    ASSERT(&moved[0] == data)
+    ASSERT(moved.size() == 5)
+}
+#endif
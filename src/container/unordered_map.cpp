@@ -0,0 +1,177 @@
+#include "test_container.hpp"
+#include "container/unordered_map.hpp"
+#include "util/functional.hpp"
+#include "util/hash.hpp"
+#include <map>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    typedef ft::unordered_map<int, int> int_map;
+
+    template <class Map>
+    bool same_contents(const Map &map, const std::map<typename Map::key_type, typename Map::mapped_type> &expected)
+    {
+        if (map.size() != expected.size())
+            return false;
+        std::size_t visited = 0;
+        for (typename Map::const_iterator it = map.begin(); it != map.end(); ++it, ++visited)
+        {
+            typename std::map<typename Map::key_type, typename Map::mapped_type>::const_iterator other = expected.find(it->first);
+            if (other == expected.end() || !(other->second == it->second))
+                return false;
+        }
+        return visited == expected.size();
+    }
+}
+
+TEST(unordered_map, random_insert_find_erase)
+{
+    int_map map;
+    std::map<int, int> expected;
+    unsigned int seed = 11;
+    bool ok = map.empty() && map.begin() == map.end() && map.find(3) == map.end();
+
+    for (int step = 0; step < 50000; ++step)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const int key = static_cast<int>((seed >> 8) % 3000);
+        switch ((seed >> 4) % 3)
+        {
+        case 0:
+            ok = ok && map.erase(key) == expected.erase(key);
+            break;
+        case 1:
+            ok = ok && map.insert(int_map::value_type(key, step)).second == expected.insert(std::make_pair(key, step)).second;
+            break;
+        default:
+            ok = ok && map.count(key) == expected.count(key);
+            ok = ok && (map.find(key) == map.end() ? expected.count(key) == 0 : map.find(key)->second == expected[key]);
+            break;
+        }
+        if (step % 5000 == 0)
+            ok = ok && same_contents(map, expected);
+    }
+
+    ASSERT(ok)
+    ASSERT(same_contents(map, expected))
+    ASSERT(map.load_factor() <= map.max_load_factor())
+}
+
+TEST(unordered_map, element_access)
+{
+    ft::unordered_map<std::string, std::string> map;
+
+    map["one"] = "1";
+    map["two"] = "2";
+    map["one"] += "!";
+
+    ASSERT(map.size() == 2)
+    ASSERT(map.at("one") == "1!")
+    ASSERT(map["three"].empty() && map.size() == 3)
+
+    bool thrown = false;
+    try
+    {
+        map.at("four");
+    }
+    catch (const std::out_of_range &)
+    {
+        thrown = true;
+    }
+
+    ASSERT(thrown)
+}
+
+TEST(unordered_map, copy_swap_compare)
+{
+    int_map a;
+    for (int key = 0; key < 500; ++key)
+        a[key] = key * 3;
+    for (int key = 0; key < 500; key += 3)
+        a.erase(key);
+
+    int_map b(a);
+    int_map c;
+    c = a;
+
+    ASSERT(a == b && b == c)
+
+    c[1000] = 1;
+    c.erase(1000);
+    c[1] = 4;
+
+    ASSERT(a != c)
+
+    int_map d;
+    d.swap(c);
+
+    ASSERT(c.empty() && d.size() == a.size() && d.at(1) == 4)
+
+    d.clear();
+
+    ASSERT(d.empty() && d.begin() == d.end() && d.bucket_count() != 0)
+}
+
+TEST(unordered_map, reserve_keeps_slots)
+{
+    int_map map;
+    map.reserve(1000);
+
+    const std::size_t buckets = map.bucket_count();
+    for (int key = 0; key < 1000; ++key)
+        map[key * 7919] = key;
+
+    ASSERT(buckets >= 1000 && map.bucket_count() == buckets)
+
+    // Erasing everything and refilling reuses the slots: no growth.
+    for (int round = 0; round < 20; ++round)
+    {
+        for (int key = 0; key < 1000; ++key)
+            map.erase(key * 7919 + round);
+        for (int key = 0; key < 1000; ++key)
+            map[key * 7919 + round + 1] = key;
+    }
+
+    ASSERT(map.size() == 1000 && map.bucket_count() == buckets)
+
+    map.clear();
+    map.rehash(0);
+
+    ASSERT(map.bucket_count() < buckets)
+}
+
+TEST(unordered_map, heterogeneous_lookup)
+{
+    ft::unordered_map<std::string, int, ft::hash<std::string>, ft::equal_to<> > map;
+
+    map["alpha"] = 1;
+    map["beta"] = 2;
+
+    const char *key = "beta";
+
+    ASSERT(map.find(key) != map.end() && map.find(key)->second == 2)
+    ASSERT(map.count("gamma") == 0)
+    ASSERT(map.erase("alpha") == 1 && map.size() == 1)
+}
+
+TEST(unordered_map, heterogeneous_erase_by_iterator)
+{
+    typedef ft::unordered_map<std::string, int, ft::hash<std::string>, ft::equal_to<> > map_type;
+    map_type map;
+
+    map["alpha"] = 1;
+    map["beta"] = 2;
+    map["gamma"] = 3;
+
+    map.erase(map.begin());
+    ASSERT(map.size() == 2)
+
+    map_type::const_iterator first = map.begin();
+    map.erase(first);
+    ASSERT(map.size() == 1)
+
+    map.erase(map.begin(), map.end());
+    ASSERT(map.empty())
+}
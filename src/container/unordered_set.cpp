@@ -0,0 +1,68 @@
+#include "test_container.hpp"
+#include "container/unordered_set.hpp"
+#include <set>
+#include <string>
+
+TEST(unordered_set, insert_erase_iterate)
+{
+    ft::unordered_set<std::string> set;
+    std::set<std::string> expected;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        const std::string key(i % 40 + 1, static_cast<char>('a' + i % 26));
+        ASSERT(set.insert(key).second == expected.insert(key).second)
+    }
+
+    ASSERT(set.size() == expected.size())
+
+    std::size_t visited = 0;
+    for (ft::unordered_set<std::string>::iterator it = set.begin(); it != set.end(); ++it, ++visited)
+        ASSERT(expected.count(*it) == 1)
+
+    ASSERT(visited == expected.size())
+
+    // Erasing while iterating hands back the next element.
+    for (ft::unordered_set<std::string>::iterator it = set.begin(); it != set.end();)
+        if (it->size() % 2 == 0)
+            it = set.erase(it);
+        else
+            ++it;
+
+    bool ok = true;
+    for (std::set<std::string>::const_iterator it = expected.begin(); it != expected.end(); ++it)
+        ok = ok && set.count(*it) == it->size() % 2;
+
+    ASSERT(ok)
+}
+
+TEST(unordered_set, equality_ignores_order)
+{
+    ft::unordered_set<int> a;
+    ft::unordered_set<int> b(4096);
+
+    for (int i = 0; i < 300; ++i)
+    {
+        a.insert(i);
+        b.insert(299 - i);
+    }
+
+    ASSERT(a == b)
+    ASSERT(a.bucket_count() != b.bucket_count())
+
+    b.erase(b.find(150));
+
+    ASSERT(a != b && b.find(150) == b.end())
+}
+
+TEST(unordered_set, heterogeneous_erase_by_iterator)
+{
+    ft::unordered_set<std::string, ft::hash<std::string>, ft::equal_to<> > set;
+
+    set.insert("alpha");
+    set.insert("beta");
+
+    set.erase(set.begin());
+    ASSERT(set.size() == 1 && set.count("alpha") + set.count("beta") == 1)
+    ASSERT(set.erase("alpha") + set.erase("beta") == 1 && set.empty())
+}
@@ -1,6 +1,8 @@
 #include "test_container.hpp"
 #include "container/vector.hpp"
+#include "util/pair.hpp"
 #include <vector>
+#include <limits>
 
 TEST(vector, constructor_default)
 {
@@ -1005,3 +1007,440 @@ TEST(vector, non_member_swap)
     for (int index = 0; index < 5; ++index)
         ASSERT(bar[index] == 100)
 }
+
+TEST(vector, insert_single_element_under_capacity)
+{
+    int b[] = {0, 1, 42, 2, 3, 4};
+
+    NS::vector<int> a;
+
+    a.reserve(10);
+    for (int index = 0; index < 5; ++index)
+        a.push_back(index);
+
+    a.insert(a.begin() + 2, 42);
+
+    ASSERT(a.size() == 6)
+    ASSERT(a.capacity() == 10)
+
+    for (int index = 0; index < 6; ++index)
+        ASSERT(a[index] == b[index])
+}
+
+TEST(vector, insert_range)
+{
+    int arr[] = {7, 8, 9};
+    int b[] = {0, 1, 7, 8, 9, 2, 3, 4};
+
+    NS::vector<int> a;
+
+    for (int index = 0; index < 5; ++index)
+        a.push_back(index);
+
+    a.insert(a.begin() + 2, arr, arr + 3);
+
+    ASSERT(a.size() == 8)
+
+    for (int index = 0; index < 8; ++index)
+        ASSERT(a[index] == b[index])
+}
+
+TEST(vector, insert_range_under_capacity)
+{
+    int arr[] = {7, 8, 9};
+    int b[] = {0, 1, 7, 8, 9, 2, 3, 4};
+
+    NS::vector<int> a;
+
+    a.reserve(10);
+    for (int index = 0; index < 5; ++index)
+        a.push_back(index);
+
+    a.insert(a.begin() + 2, arr, arr + 3);
+
+    ASSERT(a.size() == 8)
+    ASSERT(a.capacity() == 10)
+
+    for (int index = 0; index < 8; ++index)
+        ASSERT(a[index] == b[index])
+}
+
+TEST(vector, string_growth)
+{
+    NS::vector<std::string> v;
+
+    for (int index = 0; index < 100; ++index)
+        v.push_back(std::string(index, 'x'));
+
+    v.insert(v.begin() + 10, 3, std::string("inserted"));
+    v.resize(50);
+
+    ASSERT(v.size() == 50)
+    ASSERT(v[9] == std::string(9, 'x'))
+    ASSERT(v[10] == "inserted" && v[12] == "inserted")
+    ASSERT(v[13] == std::string(10, 'x'))
+
+    NS::vector<std::string> copy(v);
+
+    copy.assign(5, "assigned");
+
+    ASSERT(copy.size() == 5 && copy[4] == "assigned")
+    ASSERT(v[49] == std::string(46, 'x'))
+}
+
+struct point
+{
+    int x;
+    int y;
+};
+
+TEST(vector, pod_fill_and_copy)
+{
+    point p = {3, -1};
+
+    NS::vector<point> v(1000, p);
+
+    v.resize(2000);
+    v.reserve(5000);
+
+    NS::vector<point> copy(v);
+
+    ASSERT(copy.size() == 2000)
+    ASSERT(copy[999].x == 3 && copy[999].y == -1)
+    ASSERT(copy[1000].x == 0 && copy[1999].y == 0)
+}
+
+TEST(vector, insert_more_than_double_capacity)
+{
+    NS::vector<int> v(2, 1);
+
+    v.insert(v.begin() + 1, 10, 7);
+
+    ASSERT(v.size() == 12 && v.capacity() >= 12)
+    ASSERT(v[0] == 1 && v[1] == 7 && v[10] == 7 && v[11] == 1)
+}
+
+#if __cplusplus >= 201103L
+
+struct move_counter
+{
+    static int copies;
+    static int moves;
+
+    int value;
+
+    move_counter(int v) : value(v) {}
+    move_counter(const move_counter &other) : value(other.value) { ++copies; }
+    move_counter(move_counter &&other) noexcept : value(other.value) { other.value = -1; ++moves; }
+    move_counter &operator=(const move_counter &other) { value = other.value; ++copies; return *this; }
+};
+
+int move_counter::copies = 0;
+int move_counter::moves = 0;
+
+TEST(vector, move_construct_and_assign)
+{
+    NS::vector<std::string> v(10, "payload");
+    const std::string *data = &v[0];
+
+    NS::vector<std::string> moved(std::move(v));
+
+    ASSERT(v.empty() && moved.size() == 10 && &moved[0] == data)
+
+    NS::vector<std::string> assigned(3, "old");
+    assigned = std::move(moved);
+
+    ASSERT(assigned.size() == 10 && &assigned[0] == data && assigned[9] == "payload")
+}
+
+TEST(vector, growth_moves_elements)
+{
+    move_counter::copies = 0;
+    move_counter::moves = 0;
+
+    NS::vector<move_counter> v;
+    for (int i = 0; i < 100; ++i)
+        v.emplace_back(i);
+
+    ASSERT(move_counter::copies == 0 && move_counter::moves > 0)
+    ASSERT(v.size() == 100 && v[0].value == 0 && v[99].value == 99)
+}
+
+TEST(vector, growth_moves_pairs)
+{
+    NS::vector<NS::pair<move_counter, int> > v;
+    for (int i = 0; i < 10; ++i)
+        v.push_back(NS::pair<move_counter, int>(move_counter(i), i));
+
+    move_counter::copies = 0;
+    move_counter::moves = 0;
+    v.reserve(v.capacity() + 1);
+
+    ASSERT(move_counter::copies == 0 && move_counter::moves == 10)
+    ASSERT(v[0].first.value == 0 && v[9].first.value == 9)
+}
+
+TEST(vector, push_back_rvalue)
+{
+    NS::vector<std::string> v;
+    std::string s(100, 'z');
+
+    v.push_back(std::move(s));
+    v.push_back(std::string("tail"));
+
+    ASSERT(v.size() == 2 && v[0] == std::string(100, 'z') && v[1] == "tail")
+}
+
+TEST(vector, emplace)
+{
+    NS::vector<std::string> v;
+
+    v.emplace_back(3, 'a');
+    v.emplace(v.begin(), 2, 'b');
+    v.emplace(v.begin() + 1, "middle");
+    v.reserve(10);
+    v.emplace(v.begin(), v[2]);
+    v.insert(v.end(), std::string("end"));
+
+    ASSERT(v.size() == 5)
+    ASSERT(v[0] == "aaa" && v[1] == "bb" && v[2] == "middle" && v[3] == "aaa" && v[4] == "end")
+}
+
+#endif
+
+TEST(vector, reverse_iteration)
+{
+    NS::vector<int> v;
+
+    for (int index = 0; index < 5; ++index)
+        v.push_back(index);
+
+    const NS::vector<int> &c = v;
+
+    ASSERT(*v.rbegin() == 4 && *(v.rend() - 1) == 0 && v.rend() - v.rbegin() == 5)
+    ASSERT(*c.rbegin() == 4 && *(c.rend() - 1) == 0)
+}
+
+TEST(vector, erase)
+{
+    NS::vector<std::string> v;
+
+    for (int index = 0; index < 10; ++index)
+        v.push_back(std::string(index + 20, 'a' + index));
+
+    NS::vector<std::string>::iterator it = v.erase(v.begin() + 2);
+
+    ASSERT(v.size() == 9 && *it == std::string(23, 'd'))
+
+    it = v.erase(v.begin() + 1, v.begin() + 4);
+
+    ASSERT(v.size() == 6 && *it == std::string(25, 'f') && v[0] == std::string(20, 'a'))
+
+    it = v.erase(v.begin() + 3, v.end());
+
+    ASSERT(it == v.end() && v.size() == 3 && v.back() == std::string(26, 'g'))
+}
+
+TEST(vector, reverse_iterator_arithmetic)
+{
+    NS::vector<int> v;
+
+    for (int index = 0; index < 5; ++index)
+        v.push_back(index);
+
+    NS::vector<int>::reverse_iterator first = v.rbegin();
+    NS::vector<int>::reverse_iterator last = v.rend();
+
+    ASSERT(first != last && first < last && first <= last && last > first && last >= first)
+    ASSERT(!(first == last) && !(last < first))
+    ASSERT(*(2 + first) == 2 && *(first + 4) == 0 && first[1] == 3)
+    ASSERT(last - first == 5 && first - last == -5)
+}
+
+TEST(vector, compare_integral)
+{
+    NS::vector<int> a;
+    for (int i = 0; i < 1000; ++i)
+        a.push_back(i - 500);
+
+    bool ok = true;
+    for (int position = 0; position < 1000; position += 37)
+    {
+        NS::vector<int> b(a);
+        b[position] += 1;
+        ok = ok && a != b && a < b && !(b < a) && b > a;
+        b[position] -= 2;
+        ok = ok && b < a && !(a < b);
+    }
+    NS::vector<int> prefix(a.begin(), a.begin() + 999);
+
+    ASSERT(ok && a == NS::vector<int>(a))
+    ASSERT(prefix < a && !(a < prefix) && prefix != a)
+}
+
+TEST(vector, compare_signed_bytes)
+{
+    NS::vector<char> a(100, 'x');
+    NS::vector<char> b(a);
+    NS::vector<long> c(50, -1);
+    NS::vector<long> d(c);
+
+    b[70] = static_cast<char>(-5);
+    d[49] = 1;
+
+    ASSERT(b < a && !(a < b))
+    ASSERT(c < d && !(d < c) && c != d)
+}
+
+TEST(vector, compare_floating)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    NS::vector<double> a(40, 1.5);
+    NS::vector<double> b(a);
+
+    a[10] = 0.0;
+    b[10] = -0.0;
+
+    ASSERT(a == b && !(a < b) && !(b < a))
+
+    a[20] = nan;
+    b[20] = nan;
+
+    ASSERT(a != b && !(a < b) && !(b < a))
+
+    b[30] = 2.0;
+
+    ASSERT(a < b && !(b < a))
+
+    NS::vector<float> f(33, 1.0f);
+    NS::vector<float> g(f);
+    g[32] = 0.5f;
+
+    ASSERT(g < f && f != g)
+}
+
+namespace
+{
+    // Copying throws once `copies_left` reaches zero; `live` counts the
+    // objects alive so that a leak or a double destroy shows up.
+    struct throwing_copy
+    {
+        static int copies_left;
+        static int live;
+        int value;
+
+        throwing_copy(int v = 0) : value(v) { ++live; }
+
+        throwing_copy(const throwing_copy &other) : value(other.value)
+        {
+            if (copies_left == 0)
+                throw std::runtime_error("throwing_copy");
+            --copies_left;
+            ++live;
+        }
+
+        throwing_copy &operator=(const throwing_copy &other)
+        {
+            value = other.value;
+            return *this;
+        }
+
+        ~throwing_copy() { --live; }
+    };
+
+    int throwing_copy::copies_left = -1;
+    int throwing_copy::live = 0;
+
+    bool holds_sequence(const NS::vector<throwing_copy> &v, int n)
+    {
+        if (v.size() != static_cast<std::size_t>(n))
+            return false;
+        for (int i = 0; i < n; ++i)
+            if (v[i].value != i)
+                return false;
+        return true;
+    }
+}
+
+TEST(vector, growth_strong_guarantee)
+{
+    {
+        NS::vector<throwing_copy> v;
+        for (int i = 0; i < 8; ++i)
+            v.push_back(throwing_copy(i));
+        v.reserve(8);
+        const std::size_t capacity = v.capacity();
+        while (v.size() < capacity)
+            v.push_back(throwing_copy(static_cast<int>(v.size())));
+        const int n = static_cast<int>(v.size());
+
+        // Fail the new element, then each element moved to the new block.
+        for (int fail_at = 0; fail_at <= n; ++fail_at)
+        {
+            bool thrown = false;
+            throwing_copy::copies_left = fail_at;
+            try
+            {
+                v.push_back(throwing_copy(n));
+            }
+            catch (const std::runtime_error &)
+            {
+                thrown = true;
+            }
+            throwing_copy::copies_left = -1;
+            ASSERT(thrown)
+            ASSERT(v.capacity() == capacity && holds_sequence(v, n))
+            ASSERT(throwing_copy::live == n)
+        }
+
+        throwing_copy::copies_left = 3;
+        try
+        {
+            v.insert(v.begin() + 2, 4, throwing_copy(-1));
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        throwing_copy::copies_left = -1;
+        ASSERT(v.capacity() == capacity && holds_sequence(v, n))
+    }
+    ASSERT(throwing_copy::live == 0)
+}
+
+TEST(vector, assign_throwing_copy)
+{
+    {
+        NS::vector<throwing_copy> v(4, throwing_copy(1));
+        NS::vector<throwing_copy> big(16, throwing_copy(2));
+        NS::vector<throwing_copy> small(2, throwing_copy(3));
+
+        throwing_copy::copies_left = 5;
+        try
+        {
+            v = big;
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        throwing_copy::copies_left = 1;
+        try
+        {
+            v = small;
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        throwing_copy::copies_left = 0;
+        try
+        {
+            NS::vector<throwing_copy> copy(big);
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        throwing_copy::copies_left = -1;
+        ASSERT(v.size() <= 2)
+        ASSERT(throwing_copy::live == static_cast<int>(v.size()) + 18)
+    }
+    ASSERT(throwing_copy::live == 0)
+}
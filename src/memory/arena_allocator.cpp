@@ -0,0 +1,130 @@
+#include "memory/arena_allocator.hpp"
+#include "test_container.hpp"
+#include "container/stack.hpp"
+#include "container/vector.hpp"
+#include "tree/rb_tree.hpp"
+
+TEST(arena_allocator, bump_allocation)
+{
+  ft::arena arena;
+  ft::arena_allocator<int> alloc(arena);
+
+  int *a = alloc.allocate(1);
+  int *b = alloc.allocate(1);
+
+  ASSERT(b == a + 1)
+
+  alloc.deallocate(a, 1);
+
+  ASSERT(alloc.allocate(1) == b + 1)
+}
+
+TEST(arena_allocator, initial_buffer)
+{
+  char buffer[256];
+  ft::arena arena(buffer, sizeof(buffer));
+  ft::arena_allocator<double> alloc(arena);
+
+  double *ptr = alloc.allocate(8);
+
+  ASSERT(reinterpret_cast<char *>(ptr) >= buffer)
+  ASSERT(reinterpret_cast<char *>(ptr + 8) <= buffer + sizeof(buffer))
+
+  double *big = alloc.allocate(1000);
+
+  ASSERT(reinterpret_cast<char *>(big) < buffer || reinterpret_cast<char *>(big) >= buffer + sizeof(buffer))
+
+  for (int index = 0; index < 1000; ++index)
+    big[index] = index;
+
+  arena.release();
+
+  ASSERT(alloc.allocate(8) == ptr)
+}
+
+TEST(arena_allocator, odd_sized_buffer_mixed_alignments)
+{
+  // 16-aligned storage, of which the arena gets an odd 13 bytes.
+  union
+  {
+    char bytes[32];
+    long double align;
+  } storage;
+  char *buffer = storage.bytes;
+  ft::arena arena(buffer, 13);
+
+  char *a = static_cast<char *>(arena.allocate(12, 1));
+  char *b = static_cast<char *>(arena.allocate(8, 8));
+
+  ASSERT(a == buffer)
+  ASSERT(b < buffer || b >= buffer + sizeof(storage))
+  ASSERT(reinterpret_cast<std::size_t>(b) % 8 == 0)
+
+  bool ok = true;
+  for (int index = 0; index < 200; ++index)
+  {
+    const std::size_t align = static_cast<std::size_t>(1) << (index % 5);
+    char *p = static_cast<char *>(arena.allocate(index % 7 + 1, align));
+    const bool in_block = p < buffer || p >= buffer + sizeof(storage);
+    ok = ok && reinterpret_cast<std::size_t>(p) % align == 0 && (in_block || p + index % 7 + 1 <= buffer + 13);
+  }
+
+  ASSERT(ok)
+}
+
+TEST(arena_allocator, rebind_shares_arena)
+{
+  ft::arena arena;
+  ft::arena_allocator<int> a(arena);
+  ft::arena_allocator<char> b(a);
+
+  ASSERT(a == b)
+  ASSERT(b.arena() == &arena)
+}
+
+TEST(arena_allocator, vector)
+{
+  ft::arena arena;
+  ft::arena_allocator<int> alloc(arena);
+  ft::vector<int, ft::arena_allocator<int> > v(alloc);
+
+  for (int index = 0; index < 1000; ++index)
+    v.push_back(index);
+
+  ft::vector<int, ft::arena_allocator<int> > copy(v);
+
+  ASSERT(copy.size() == 1000)
+  for (int index = 0; index < 1000; ++index)
+    ASSERT(copy[index] == index)
+}
+
+TEST(arena_allocator, stack)
+{
+  typedef ft::vector<int, ft::arena_allocator<int> > container;
+
+  ft::arena arena;
+  ft::stack<int, container> s((container(ft::arena_allocator<int>(arena))));
+
+  for (int index = 0; index < 100; ++index)
+    s.push(index);
+
+  ASSERT(s.size() == 100)
+  ASSERT(s.top() == 99)
+}
+
+TEST(arena_allocator, rb_tree)
+{
+  ft::arena arena;
+  ft::rb_tree<int, std::less<int>, ft::arena_allocator<int> > tree((std::less<int>()), ft::arena_allocator<int>(arena));
+
+  for (int index = 0; index < 1000; ++index)
+    tree.insert((index * 7919) % 1000);
+  for (int index = 0; index < 1000; index += 2)
+    tree.remove(index);
+
+  ft::rb_tree<int, std::less<int>, ft::arena_allocator<int> > copy(tree);
+
+  ASSERT(copy.size() == 500)
+  ASSERT(*copy.begin() == 1)
+  ASSERT(copy.get_allocator().arena() == &arena)
+}
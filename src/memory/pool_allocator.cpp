@@ -0,0 +1,148 @@
+#include "memory/pool_allocator.hpp"
+#include "test_container.hpp"
+#include "tree/rb_tree.hpp"
+#include "dummy.hpp"
+#include <pthread.h>
+
+TEST(pool_allocator, allocate_reuses_freed_block)
+{
+  ft::pool_allocator<long> alloc;
+
+  long *a = alloc.allocate(1);
+  long *b = alloc.allocate(1);
+
+  ASSERT(a != b)
+
+  alloc.deallocate(a, 1);
+
+  ASSERT(alloc.allocate(1) == a)
+
+  alloc.deallocate(a, 1);
+  alloc.deallocate(b, 1);
+}
+
+TEST(pool_allocator, allocate_sequential_blocks)
+{
+  ft::pool_allocator<long> alloc;
+
+  long *first = alloc.allocate(1);
+
+  for (int index = 1; index < 16; ++index)
+    ASSERT(alloc.allocate(1) == first + index)
+}
+
+TEST(pool_allocator, allocate_contiguous)
+{
+  ft::pool_allocator<ft::dummy<int> > alloc;
+  ft::pool_allocator<ft::dummy<int> >::pointer ptr;
+
+  ptr = alloc.allocate(100);
+
+  for (int index = 0; index < 100; ++index)
+    alloc.construct(ptr + index, ft::dummy<int>(index));
+
+  for (int index = 0; index < 100; ++index)
+    ASSERT(index == ptr[index].value)
+
+  for (int index = 0; index < 100; ++index)
+    alloc.destroy(ptr + index);
+
+  alloc.deallocate(ptr, 100);
+}
+
+TEST(pool_allocator, copies_share_resource)
+{
+  ft::pool_allocator<int> a;
+  ft::pool_allocator<int> b(a);
+  ft::pool_allocator<double> c(a);
+  ft::pool_allocator<int> d;
+
+  ASSERT(a == b)
+  ASSERT(a == c)
+  ASSERT(a != d)
+
+  int *ptr = a.allocate(1);
+  b.deallocate(ptr, 1);
+
+  d = c;
+
+  ASSERT(d == a)
+}
+
+namespace
+{
+  // Copies and drops the shared allocator many times.
+  void *copy_allocator(void *argument)
+  {
+    const ft::pool_allocator<int> &shared = *static_cast<ft::pool_allocator<int> *>(argument);
+    for (int index = 0; index < 100000; ++index)
+    {
+      ft::pool_allocator<int> copy(shared);
+      ft::pool_allocator<double> rebound(copy);
+    }
+    return NULL;
+  }
+}
+
+TEST(pool_allocator, copies_from_threads)
+{
+  const int threads = 4;
+  ft::pool_allocator<int> shared;
+  pthread_t workers[threads];
+
+  for (int index = 0; index < threads; ++index)
+    pthread_create(&workers[index], NULL, copy_allocator, &shared);
+  for (int index = 0; index < threads; ++index)
+    pthread_join(workers[index], NULL);
+
+  // A lost decrement would have freed the resource under us.
+  int *ptr = shared.allocate(1);
+  *ptr = 42;
+  ASSERT(*ptr == 42)
+  shared.deallocate(ptr, 1);
+}
+
+#if __cplusplus >= 201103L
+namespace
+{
+  struct alignas(64) cache_line
+  {
+    char bytes[8];
+  };
+}
+
+TEST(pool_allocator, over_aligned_blocks)
+{
+  ft::pool_allocator<cache_line> alloc;
+  ft::pool_allocator<char> bytes(alloc);
+  bool aligned = true;
+
+  for (int index = 0; index < 100; ++index)
+  {
+    bytes.allocate(1);
+    aligned = aligned && reinterpret_cast<std::size_t>(alloc.allocate(1)) % 64 == 0;
+  }
+  aligned = aligned && reinterpret_cast<std::size_t>(alloc.allocate(3)) % 64 == 0;
+
+  ASSERT(aligned)
+}
+#endif
+
+TEST(pool_allocator, rb_tree_default)
+{
+  ft::rb_tree<int> tree;
+
+  for (int index = 0; index < 1000; ++index)
+    tree.insert(index);
+  for (int index = 0; index < 1000; index += 2)
+    tree.remove(index);
+  for (int index = 0; index < 1000; index += 2)
+    tree.insert(index);
+
+  ASSERT(tree.size() == 1000)
+  ASSERT(tree.get_allocator() == ft::pool_allocator<int>(tree.get_allocator()))
+
+  int index = 0;
+  for (ft::rb_tree<int>::iterator it = tree.begin(); it != tree.end(); ++it)
+    ASSERT(*it == index++)
+}
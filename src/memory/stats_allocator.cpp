@@ -0,0 +1,72 @@
+#include "memory/stats_allocator.hpp"
+#include "memory/pool_allocator.hpp"
+#include "test_container.hpp"
+#include "container/vector.hpp"
+#include "tree/rb_tree.hpp"
+
+TEST(stats_allocator, counts_and_histogram)
+{
+  ft::allocation_stats stats;
+  ft::stats_allocator<int> alloc(stats);
+
+  int *a = alloc.allocate(1);
+  int *b = alloc.allocate(100);
+
+  ASSERT(stats.allocations == 2)
+  ASSERT(stats.bytes_live == 404)
+  ASSERT(stats.histogram[2] == 1)
+  ASSERT(stats.histogram[8] == 1)
+
+  alloc.deallocate(b, 100);
+  alloc.deallocate(a, 1);
+
+  ASSERT(stats.deallocations == 2)
+  ASSERT(stats.bytes_live == 0)
+  ASSERT(stats.peak_bytes == 404)
+  ASSERT(stats.bytes_allocated == 404)
+}
+
+TEST(stats_allocator, vector_growth)
+{
+  ft::allocation_stats stats;
+  {
+    ft::vector<int, ft::stats_allocator<int> > v((ft::stats_allocator<int>(stats)));
+
+    for (int index = 0; index < 100; ++index)
+      v.push_back(index);
+
+    // Capacities 1, 2, 4, ..., 128; the 64 -> 128 move holds both blocks.
+    ASSERT(stats.allocations == 8)
+    ASSERT(stats.deallocations == 7)
+    ASSERT(stats.peak_bytes == (64 + 128) * sizeof(int))
+  }
+
+  ASSERT(stats.deallocations == 8)
+  ASSERT(stats.bytes_live == 0)
+}
+
+TEST(stats_allocator, rebind_reports_to_same_stats)
+{
+  typedef ft::stats_allocator<int, ft::pool_allocator<int> > allocator_type;
+
+  ft::allocation_stats stats;
+  {
+    ft::rb_tree<int, std::less<int>, allocator_type> tree((std::less<int>()), allocator_type(stats));
+
+    for (int index = 0; index < 1000; ++index)
+      tree.insert(index);
+
+    ASSERT(stats.allocations != 0)
+    ASSERT(stats.bytes_live >= 1000 * sizeof(int))
+  }
+
+  ASSERT(stats.bytes_live == 0)
+}
+
+TEST(stats_allocator, global_stats)
+{
+  ft::vector<char, ft::stats_allocator<char> > v(10, 'a');
+
+  ASSERT(ft::allocation_stats::global().allocations == 1)
+  ASSERT(ft::allocation_stats::global().bytes_live == 10)
+}
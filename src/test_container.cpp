@@ -1,10 +1,124 @@
 #include "test_container.hpp"
+#include "memory/stats_allocator.hpp"
+#include "perf_counters.hpp"
 
 #include <bits/stdc++.h>
+#include <pthread.h>
 #include <sys/time.h>
 
 std::map<std::string, test_container::test_function> test_container::tests;
 
+// Every allocation made through operator new in this binary, whatever the
+// allocator: the replacement operators below record into it, under a lock
+// since some tests allocate from several threads.
+static ft::allocation_stats heap_stats;
+static pthread_mutex_t heap_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Each block carries its size in front of it, so that operator delete can
+// record the bytes it releases; the header keeps malloc's alignment.
+static const std::size_t heap_header = 16;
+
+static void *counted_allocate(std::size_t bytes)
+{
+    char *block = static_cast<char *>(std::malloc(heap_header + bytes));
+    if (block == NULL)
+        return NULL;
+    *reinterpret_cast<std::size_t *>(block) = bytes;
+    pthread_mutex_lock(&heap_stats_lock);
+    heap_stats.record_allocation(bytes);
+    pthread_mutex_unlock(&heap_stats_lock);
+    return block + heap_header;
+}
+
+static void counted_release(void *p)
+{
+    if (p == NULL)
+        return;
+    char *block = static_cast<char *>(p) - heap_header;
+    pthread_mutex_lock(&heap_stats_lock);
+    heap_stats.record_deallocation(*reinterpret_cast<std::size_t *>(block));
+    pthread_mutex_unlock(&heap_stats_lock);
+    std::free(block);
+}
+
+static void *counted_new(std::size_t bytes)
+{
+    for (;;)
+    {
+        void *p = counted_allocate(bytes);
+        if (p != NULL)
+            return p;
+        std::new_handler handler = std::set_new_handler(0);
+        std::set_new_handler(handler);
+        if (handler == 0)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+static void *counted_new(std::size_t bytes, const std::nothrow_t &) throw()
+{
+    try
+    {
+        return counted_new(bytes);
+    }
+    catch (...)
+    {
+        return NULL;
+    }
+}
+
+#if __cplusplus >= 201103L
+# define THROWS_BAD_ALLOC
+#else
+# define THROWS_BAD_ALLOC throw(std::bad_alloc)
+#endif
+
+void *operator new(std::size_t bytes) THROWS_BAD_ALLOC { return counted_new(bytes); }
+
+void *operator new[](std::size_t bytes) THROWS_BAD_ALLOC { return counted_new(bytes); }
+
+void *operator new(std::size_t bytes, const std::nothrow_t &tag) throw() { return counted_new(bytes, tag); }
+
+void *operator new[](std::size_t bytes, const std::nothrow_t &tag) throw() { return counted_new(bytes, tag); }
+
+void operator delete(void *p) throw() { counted_release(p); }
+
+void operator delete[](void *p) throw() { counted_release(p); }
+
+void operator delete(void *p, const std::nothrow_t &) throw() { counted_release(p); }
+
+void operator delete[](void *p, const std::nothrow_t &) throw() { counted_release(p); }
+
+static ft::allocation_stats heap_snapshot()
+{
+    pthread_mutex_lock(&heap_stats_lock);
+    ft::allocation_stats stats = heap_stats;
+    pthread_mutex_unlock(&heap_stats_lock);
+    return stats;
+}
+
+static void heap_reset()
+{
+    pthread_mutex_lock(&heap_stats_lock);
+    heap_stats.reset();
+    pthread_mutex_unlock(&heap_stats_lock);
+}
+
+// Allocation counts of a test: every operator new and delete it made.
+static std::string allocation_report(const ft::allocation_stats &stats)
+{
+    if (stats.allocations == 0 && stats.deallocations == 0)
+        return "";
+    std::ostringstream report;
+    report << " [allocs " << stats.allocations << ", frees " << stats.deallocations
+           << ", peak " << stats.peak_bytes << " B";
+    if (stats.bytes_live != 0)
+        report << ", live " << stats.bytes_live << " B";
+    report << "]";
+    return report.str();
+}
+
 bool test_container::register_test(std::string test, test_function result)
 {
     if (tests.find(test) != tests.end())
@@ -13,26 +127,42 @@ bool test_container::register_test(std::string test, test_function result)
     return true;
 };
 
-void test_container::run()
+void test_container::run(bool with_counters)
 {
     struct timespec start, end;
     double elapsed;
+    perf_counters counters(with_counters);
+
+    if (with_counters && !counters.available())
+        std::cerr << "perf_event_open: no hardware counters available, reporting wall time only" << std::endl;
+    with_counters = with_counters && counters.available();
+    // Allocates the stream buffers now rather than inside the first test.
+    std::ios_base::sync_with_stdio(false);
 
     for (std::map<std::string, test_container::test_function>::iterator it = tests.begin(); it != tests.end(); ++it)
     {
 
+        ft::allocation_stats::global().reset();
+        heap_reset();
         clock_gettime(CLOCK_MONOTONIC, &start);
-        std::ios_base::sync_with_stdio(false);
 
         try
         {
+            if (with_counters)
+                counters.start();
             it->second();
+            if (with_counters)
+                counters.stop();
+            const ft::allocation_stats stats = heap_snapshot();
 
             clock_gettime(CLOCK_MONOTONIC, &end);
             elapsed = (end.tv_sec - start.tv_sec) * 1e9;
             elapsed = (elapsed + (end.tv_nsec - start.tv_nsec)) * 1e-9;
 
-            std::cout << GREEN << "OK: " << WHITE << std::fixed << elapsed << std::setprecision(9) << " " << it->first << std::endl;
+            std::cout << GREEN << "OK: " << WHITE << std::fixed << elapsed << std::setprecision(9) << " " << it->first
+                      << allocation_report(stats) << std::endl;
+            if (with_counters)
+                std::cout << "    " << counters.report() << std::endl;
         }
         catch (const std::exception &e)
         {
@@ -51,8 +181,13 @@ void test_container::assert_true(bool condition, std::string message)
         throw std::runtime_error(message.c_str());
 };
 
-int main()
+int main(int argc, char **argv)
 {
-    test_container::run();
+    if (argc > 2 || (argc == 2 && std::strcmp(argv[1], "-p") != 0))
+    {
+        std::cerr << "usage: " << argv[0] << " [-p]" << std::endl;
+        return 1;
+    }
+    test_container::run(argc == 2);
     return 0;
 };
@@ -0,0 +1,257 @@
+#include "test_container.hpp"
+#include "tree/persistent_rb_tree.hpp"
+#include "util/pair.hpp"
+#include <pthread.h>
+#include <set>
+#include <vector>
+
+namespace
+{
+    typedef ft::persistent_rb_tree<int> int_tree;
+
+    // In-order contents of a version against the expected set, plus the
+    // red-black height bound 2 log2(n + 1).
+    bool same_contents(const int_tree::version &v, const std::set<int> &expected)
+    {
+        if (v.size() != expected.size())
+            return false;
+        std::set<int>::const_iterator it = expected.begin();
+        for (int_tree::version::const_iterator node = v.begin(); node != v.end(); ++node, ++it)
+            if (it == expected.end() || *node != *it)
+                return false;
+        std::size_t bound = 0;
+        while ((static_cast<std::size_t>(1) << bound) <= expected.size())
+            ++bound;
+        return it == expected.end() && v.height() <= 2 * bound;
+    }
+}
+
+TEST(persistent_rb_tree, insert_find_iterate)
+{
+    int arr[] = {5, 3, 8, 1, 4, 7, 9, 2, 6, 0};
+    int_tree tree;
+
+    for (int index = 0; index < 10; ++index)
+        ASSERT(tree.insert(arr[index]))
+    ASSERT(!tree.insert(4))
+
+    int_tree::version v = tree.snapshot();
+
+    ASSERT(v.size() == 10)
+    ASSERT(v.find(7) != NULL && *v.find(7) == 7)
+    ASSERT(v.find(10) == NULL)
+    ASSERT(v.lower_bound(-3) != NULL && *v.lower_bound(-3) == 0)
+    ASSERT(v.lower_bound(10) == NULL)
+
+    int expected = 0;
+    for (int_tree::version::const_iterator it = v.begin(); it != v.end(); ++it)
+        ASSERT(*it == expected++)
+    ASSERT(expected == 10)
+}
+
+TEST(persistent_rb_tree, random_insert_remove)
+{
+    int_tree tree;
+    std::set<int> expected;
+    unsigned int seed = 42;
+    bool ok = true;
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const int key = static_cast<int>((seed >> 8) % 2000);
+        if ((seed >> 4) % 3 == 0)
+            ok = ok && tree.remove(key) == expected.erase(key);
+        else
+            ok = ok && tree.insert(key) == expected.insert(key).second;
+        if (step % 500 == 0)
+            ok = ok && same_contents(tree.snapshot(), expected);
+    }
+
+    ASSERT(ok)
+    ASSERT(same_contents(tree.snapshot(), expected))
+
+    for (int key = 0; key < 2000; ++key)
+        tree.remove(key);
+
+    ASSERT(tree.empty())
+}
+
+TEST(persistent_rb_tree, snapshots_are_immutable)
+{
+    int_tree tree;
+    std::set<int> before;
+
+    for (int index = 0; index < 1000; ++index)
+    {
+        tree.insert(index);
+        before.insert(index);
+    }
+
+    const int_tree::version old = tree.snapshot();
+    int_tree copy(tree);
+
+    for (int index = 0; index < 1000; index += 2)
+        tree.remove(index);
+    tree.insert(5000);
+
+    ASSERT(same_contents(old, before))
+    ASSERT(same_contents(copy.snapshot(), before))
+    ASSERT(tree.size() == 501)
+    ASSERT(old.find(0) != NULL && tree.snapshot().find(0) == NULL)
+}
+
+TEST(persistent_rb_tree, map_like)
+{
+    typedef ft::pair<const int, int> value_type;
+    typedef ft::persistent_rb_tree<value_type, std::less<int>, std::allocator<value_type>, ft::select_first<value_type> > map_tree;
+
+    map_tree tree;
+
+    for (int index = 0; index < 100; ++index)
+        tree.insert(value_type(index, index * index));
+
+    ASSERT(!tree.insert(value_type(3, 0)))
+    ASSERT(tree.snapshot().find(9)->second == 81)
+}
+
+namespace
+{
+    // Copying throws once `copies_left` reaches zero; `live` counts the
+    // values alive, so a node leaked by a failed write keeps it above zero.
+    struct throwing_key
+    {
+        static int copies_left;
+        static int live;
+        int key;
+
+        throwing_key(int k) : key(k) { ++live; }
+
+        throwing_key(const throwing_key &other) : key(other.key)
+        {
+            if (copies_left == 0)
+                throw std::runtime_error("throwing_key");
+            --copies_left;
+            ++live;
+        }
+
+        ~throwing_key() { --live; }
+
+        bool operator<(const throwing_key &other) const { return key < other.key; }
+
+    private:
+        throwing_key &operator=(const throwing_key &);
+    };
+
+    int throwing_key::copies_left = -1;
+    int throwing_key::live = 0;
+}
+
+TEST(persistent_rb_tree, failed_writes_leave_no_nodes)
+{
+    {
+        ft::persistent_rb_tree<throwing_key> tree;
+        std::set<int> expected;
+        unsigned int seed = 7;
+
+        // Every write may run out of copies anywhere on its path.
+        for (int step = 0; step < 3000; ++step)
+        {
+            seed = seed * 1103515245u + 12345u;
+            const int key = static_cast<int>((seed >> 8) % 300);
+            const throwing_key value(key);
+            throwing_key::copies_left = static_cast<int>((seed >> 4) % 12);
+            try
+            {
+                if ((seed >> 20) % 3 == 0)
+                {
+                    if (tree.remove(value) != 0)
+                        expected.erase(key);
+                }
+                else if (tree.insert(value))
+                    expected.insert(key);
+            }
+            catch (const std::runtime_error &)
+            {
+            }
+            throwing_key::copies_left = -1;
+        }
+
+        const ft::persistent_rb_tree<throwing_key>::version v = tree.snapshot();
+        bool ok = v.size() == expected.size();
+        std::set<int>::const_iterator it = expected.begin();
+        for (ft::persistent_rb_tree<throwing_key>::version::const_iterator node = v.begin(); ok && node != v.end(); ++node, ++it)
+            ok = node->key == *it;
+        ASSERT(ok)
+        ASSERT(throwing_key::live == static_cast<int>(expected.size()))
+    }
+    ASSERT(throwing_key::live == 0)
+}
+
+namespace
+{
+    struct reader_context
+    {
+        int_tree *tree;
+        volatile int *done;
+        bool consistent;
+    };
+
+    // The writer keeps every version a run of consecutive keys, so any
+    // snapshot can be checked on its own.
+    void *reader(void *argument)
+    {
+        reader_context *context = static_cast<reader_context *>(argument);
+        while (!__atomic_load_n(context->done, __ATOMIC_ACQUIRE))
+        {
+            const int_tree::version v = context->tree->snapshot();
+            if (v.empty())
+                continue;
+            int expected = *v.begin();
+            std::size_t count = 0;
+            for (int_tree::version::const_iterator it = v.begin(); it != v.end(); ++it, ++count)
+                context->consistent = context->consistent && *it == expected++ && expected - 1 <= 1000;
+            context->consistent = context->consistent && count == v.size();
+        }
+        return NULL;
+    }
+}
+
+TEST(persistent_rb_tree, concurrent_readers)
+{
+    const int readers = 4;
+    int_tree tree;
+    volatile int done = 0;
+    pthread_t threads[readers];
+    reader_context contexts[readers];
+
+    for (int index = 0; index < readers; ++index)
+    {
+        contexts[index].tree = &tree;
+        contexts[index].done = &done;
+        contexts[index].consistent = true;
+        pthread_create(&threads[index], NULL, reader, &contexts[index]);
+    }
+
+    // Every version is [1, n] or [0, 1000].
+    for (int round = 0; round < 50; ++round)
+    {
+        for (int key = 1; key <= 1000; ++key)
+            tree.insert(key);
+        tree.insert(0);
+        tree.remove(0);
+        for (int key = 1000; key > 500; --key)
+            tree.remove(key);
+    }
+    __atomic_store_n(&done, 1, __ATOMIC_RELEASE);
+
+    bool consistent = true;
+    for (int index = 0; index < readers; ++index)
+    {
+        pthread_join(threads[index], NULL);
+        consistent = consistent && contexts[index].consistent;
+    }
+
+    ASSERT(consistent)
+    ASSERT(tree.size() == 500)
+}
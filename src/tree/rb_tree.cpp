@@ -0,0 +1,513 @@
+#include "test_container.hpp"
+#include "tree/rb_tree.hpp"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+TEST(rb_tree, empty)
+{
+    ft::rb_tree<int> tree;
+
+    ASSERT(tree.empty())
+    ASSERT(tree.size() == 0)
+    ASSERT(tree.begin() == tree.end())
+    ASSERT(tree.rbegin() == tree.rend())
+}
+
+TEST(rb_tree, insert_sorted_iteration)
+{
+    int arr[] = {5, 3, 8, 1, 4, 7, 9, 2, 6, 0};
+
+    ft::rb_tree<int> tree;
+
+    tree.insert(arr, arr + 10);
+
+    ASSERT(tree.size() == 10)
+
+    int index = 0;
+    for (ft::rb_tree<int>::iterator it = tree.begin(); it != tree.end(); ++it)
+        ASSERT(*it == index++)
+    ASSERT(index == 10)
+}
+
+TEST(rb_tree, end_decrement)
+{
+    ft::rb_tree<int> tree;
+
+    for (int index = 0; index < 10; ++index)
+        tree.insert(index);
+
+    ft::rb_tree<int>::iterator it = tree.end();
+
+    for (int index = 9; index >= 0; --index)
+        ASSERT(*--it == index)
+    ASSERT(it == tree.begin())
+}
+
+TEST(rb_tree, reverse_iteration)
+{
+    ft::rb_tree<int> tree;
+
+    for (int index = 0; index < 10; ++index)
+        tree.insert(index);
+
+    int index = 9;
+    for (ft::rb_tree<int>::reverse_iterator it = tree.rbegin(); it != tree.rend(); ++it)
+        ASSERT(*it == index--)
+    ASSERT(index == -1)
+}
+
+TEST(rb_tree, remove)
+{
+    ft::rb_tree<int> tree;
+
+    for (int index = 0; index < 10; ++index)
+        tree.insert(index);
+
+    tree.remove(0);
+    tree.remove(9);
+    tree.remove(5);
+    tree.remove(42);
+
+    ASSERT(tree.size() == 7)
+    ASSERT(*tree.begin() == 1)
+    ASSERT(*--tree.end() == 8)
+    ASSERT(tree.find(5) == tree.end())
+}
+
+TEST(rb_tree, bounds)
+{
+    ft::rb_tree<int> tree;
+
+    for (int index = 0; index < 10; index += 2)
+        tree.insert(index);
+
+    ASSERT(*tree.lower_bound(4) == 4)
+    ASSERT(*tree.lower_bound(5) == 6)
+    ASSERT(*tree.upper_bound(4) == 6)
+    ASSERT(tree.lower_bound(9) == tree.end())
+    ASSERT(tree.upper_bound(8) == tree.end())
+}
+
+TEST(rb_tree, copy_and_swap)
+{
+    ft::rb_tree<int> a;
+    ft::rb_tree<int> b;
+
+    for (int index = 0; index < 10; ++index)
+        a.insert(index);
+
+    ft::rb_tree<int> c(a);
+
+    c.swap(b);
+
+    ASSERT(c.empty())
+    ASSERT(c.begin() == c.end())
+    ASSERT(b.size() == 10)
+    ASSERT(*b.begin() == 0)
+    ASSERT(*--b.end() == 9)
+}
+
+TEST(rb_tree, insert_sorted_range)
+{
+    ft::rb_tree<int> tree;
+
+    int arr[] = {1, 2, 2, 3, 5, 8, 13};
+
+    tree.insert(arr, arr + 7);
+
+    ASSERT(tree.size() == 7)
+
+    int index = 0;
+    for (ft::rb_tree<int>::iterator it = tree.begin(); it != tree.end(); ++it)
+        ASSERT(*it == arr[index++])
+
+    tree.insert(4);
+
+    ASSERT(*tree.lower_bound(4) == 4)
+    ASSERT(*++tree.lower_bound(4) == 5)
+}
+
+TEST(rb_tree, assign_sorted_unique)
+{
+    ft::rb_tree<int> tree;
+
+    int arr[] = {1, 1, 2, 3, 3, 3, 4};
+
+    tree.insert(42);
+    tree.assign_sorted_unique(arr, arr + 7);
+
+    ASSERT(tree.size() == 4)
+    ASSERT(tree.find(42) == tree.end())
+
+    int index = 1;
+    for (ft::rb_tree<int>::iterator it = tree.begin(); it != tree.end(); ++it)
+        ASSERT(*it == index++)
+}
+
+TEST(rb_tree, copy_large)
+{
+    ft::rb_tree<int> tree;
+
+    for (int index = 0; index < 1000; ++index)
+        tree.insert((index * 7919) % 1000);
+
+    ft::rb_tree<int> copy(tree);
+
+    tree.clear();
+
+    ASSERT(copy.size() == 1000)
+
+    int index = 0;
+    for (ft::rb_tree<int>::iterator it = copy.begin(); it != copy.end(); ++it)
+        ASSERT(*it == index++)
+
+    copy.remove(500);
+
+    ASSERT(copy.find(500) == copy.end())
+    ASSERT(*copy.lower_bound(500) == 501)
+}
+
+TEST(rb_tree, heterogeneous_lookup)
+{
+    const char *words[] = {"pear", "apple", "fig", "kiwi", "plum"};
+
+    ft::rb_tree<std::string, ft::less<> > tree;
+
+    tree.insert_unique(words, words + 5);
+
+    ASSERT(tree.find("fig") != tree.end() && *tree.find("fig") == "fig")
+    ASSERT(tree.find("grape") == tree.end())
+    ASSERT(*tree.lower_bound("grape") == "kiwi")
+    ASSERT(*tree.upper_bound("kiwi") == "pear")
+    ASSERT(tree.count("plum") == 1 && tree.count("lime") == 0)
+    ASSERT(tree.equal_range("apple").first == tree.begin())
+
+    tree.remove("apple");
+
+    ASSERT(tree.size() == 4 && *tree.begin() == "fig")
+}
+
+struct key_square
+{
+    ft::pair<const int, int> operator()(int k) const { return ft::make_pair(k, k * k); }
+};
+
+TEST(rb_tree, find_or_insert)
+{
+    typedef ft::pair<const int, int> value_type;
+
+    ft::rb_tree<value_type, std::less<int>, ft::pool_allocator<value_type>, ft::select_first<value_type> > tree;
+
+    for (int i = 0; i < 100; i += 2)
+        tree.find_or_insert(i, key_square());
+
+    ft::pair<ft::rb_tree<value_type, std::less<int>, ft::pool_allocator<value_type>,
+                         ft::select_first<value_type> >::iterator, bool> result = tree.find_or_insert(7, key_square());
+
+    ASSERT(result.second && result.first->second == 49)
+
+    result.first->second = -1;
+    result = tree.find_or_insert(7, key_square());
+
+    ASSERT(!result.second && result.first->second == -1)
+    ASSERT(tree.size() == 51)
+
+    int previous = -1;
+    for (ft::rb_tree<value_type, std::less<int>, ft::pool_allocator<value_type>,
+                     ft::select_first<value_type> >::iterator it = tree.begin(); it != tree.end(); ++it)
+    {
+        ASSERT(it->first > previous)
+        previous = it->first;
+    }
+}
+
+typedef ft::rb_tree<int, std::less<int>, ft::pool_allocator<int>, ft::identity<int>, ft::rb_counted_node<int> >
+    counted_tree;
+
+static bool counts_are_consistent(const counted_tree &tree)
+{
+    size_t index = 0;
+    for (counted_tree::const_iterator it = tree.begin(); it != tree.end(); ++it, ++index)
+        if (tree.index_of(it) != index || tree.select(index) != it)
+            return false;
+    return index == tree.size() && tree.select(index) == tree.end();
+}
+
+TEST(rb_tree, order_statistics)
+{
+    counted_tree tree;
+
+    for (int i = 0; i < 1000; ++i)
+        tree.insert((i * 7919) % 1000);
+
+    ASSERT(tree.size() == 1000 && counts_are_consistent(tree))
+    ASSERT(*tree.select(0) == 0 && *tree.select(500) == 500 && *tree.select(999) == 999)
+    ASSERT(tree.rank(250) == 250 && tree.rank(-5) == 0 && tree.rank(5000) == 1000)
+    ASSERT(tree.distance(tree.find(100), tree.find(900)) == 800)
+    ASSERT(tree.distance(tree.begin(), tree.end()) == 1000)
+
+    for (int i = 0; i < 1000; i += 3)
+        tree.remove(i);
+
+    ASSERT(tree.size() == 666 && counts_are_consistent(tree))
+    ASSERT(tree.rank(500) == 500 - 167 && *tree.select(0) == 1)
+}
+
+TEST(rb_tree, order_statistics_after_bulk_build_and_copy)
+{
+    std::vector<int> sorted;
+    for (int i = 0; i < 777; ++i)
+        sorted.push_back(i * 2);
+
+    counted_tree tree;
+    tree.assign_sorted_unique(sorted.begin(), sorted.end());
+
+    ASSERT(counts_are_consistent(tree) && tree.rank(101) == 51)
+
+    counted_tree copy(tree);
+    copy.insert(5);
+    copy.erase(copy.begin());
+
+    ASSERT(counts_are_consistent(copy) && *copy.select(2) == 5)
+    ASSERT(counts_are_consistent(tree))
+}
+
+TEST(rb_tree, compact_node_layout)
+{
+#ifndef FT_RB_TREE_WIDE_NODES
+    ASSERT(sizeof(ft::rb_node_base) == 3 * sizeof(void *))
+    ASSERT(sizeof(ft::rb_node<long>) == 4 * sizeof(void *))
+#endif
+
+    ft::rb_node_base node;
+    ft::rb_node_base parent;
+
+    node.set_parent(&parent);
+    ASSERT(node.parent() == &parent && node.color() == ft::RB_RED)
+    node.set_color(ft::RB_BLACK);
+    ASSERT(node.parent() == &parent && node.color() == ft::RB_BLACK)
+    node.set_parent(NULL);
+    ASSERT(node.parent() == NULL && node.color() == ft::RB_BLACK)
+}
+
+TEST(rb_tree, freeze)
+{
+    for (int n = 0; n < 70; ++n)
+    {
+        ft::rb_tree<int> tree;
+        for (int i = 0; i < n; ++i)
+            tree.insert_unique(i * 3);
+
+        ft::frozen_index<int> index = tree.freeze();
+        bool ok = index.size() == static_cast<size_t>(n);
+
+        for (int k = -2; k <= n * 3 + 2; ++k)
+        {
+            ft::rb_tree<int>::iterator expected = tree.lower_bound(k);
+            const int *found = index.lower_bound(k);
+            ok = ok && (expected == tree.end() ? found == NULL : found != NULL && *found == *expected);
+            ok = ok && (index.find(k) != NULL) == (k >= 0 && k % 3 == 0 && k < n * 3);
+        }
+        ASSERT(ok)
+    }
+}
+
+TEST(rb_tree, freeze_multi)
+{
+    for (int n = 0; n < 70; ++n)
+    {
+        ft::rb_tree<int> tree;
+        for (int i = 0; i < n; ++i)
+            tree.insert_equal(i % 5 == 0 ? 10 : i / 3);
+
+        ft::frozen_index<int> index = tree.freeze();
+        bool ok = index.size() == static_cast<size_t>(n);
+
+        for (int k = -1; k <= n / 3 + 1; ++k)
+        {
+            size_t expected = std::distance(tree.lower_bound(k), tree.upper_bound(k));
+            ok = ok && index.count(k) == expected && (index.find(k) != NULL) == (expected != 0);
+        }
+        ASSERT(ok)
+    }
+}
+
+TEST(rb_tree, freeze_map_like)
+{
+    typedef ft::pair<const int, int> value_type;
+
+    ft::rb_tree<value_type, std::less<int>, ft::pool_allocator<value_type>, ft::select_first<value_type> > tree;
+
+    for (int i = 0; i < 1000; ++i)
+        tree.insert_unique(value_type(i * 2, -i));
+
+    ft::frozen_index<value_type, std::less<int>, ft::select_first<value_type> > index = tree.freeze();
+
+    ASSERT(index.find(500)->second == -250 && index.find(501) == NULL)
+    ASSERT(index.lower_bound(501)->first == 502 && index.count(1998) == 1)
+}
+
+TEST(rb_tree, batched_lookups)
+{
+    ft::rb_tree<int> tree;
+    std::vector<int> keys;
+    std::vector<ft::rb_tree<int>::iterator> found;
+
+    tree.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+
+    ASSERT(found.empty())
+
+    keys.push_back(4);
+    tree.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+
+    ASSERT(found.size() == 1 && found[0] == tree.end())
+
+    for (int i = 0; i < 3000; ++i)
+        tree.insert_unique(i * 3);
+    keys.clear();
+    found.clear();
+    for (int k = -5; k < 9010; k += 2)
+        keys.push_back((k * 7919) % 9011);
+
+    std::vector<ft::rb_tree<int>::const_iterator> bounds(keys.size());
+    const ft::rb_tree<int> &view = tree;
+    tree.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+    ASSERT(view.lower_bound_batch(keys.begin(), keys.end(), bounds.begin()) == bounds.end())
+
+    bool ok = found.size() == keys.size();
+    for (size_t i = 0; ok && i < keys.size(); ++i)
+        ok = found[i] == tree.find(keys[i]) && bounds[i] == view.lower_bound(keys[i]);
+
+    ASSERT(ok)
+}
+
+// Black height of the subtree at x, or -1 when a red node has a red child,
+// the black heights differ or a parent link is wrong.
+static int checked_black_height(const ft::rb_node_base *x)
+{
+    if (x == NULL)
+        return 0;
+    if ((x->left != NULL && x->left->parent() != x) || (x->right != NULL && x->right->parent() != x))
+        return -1;
+    if (x->color() == ft::RB_RED && ((x->left != NULL && x->left->color() == ft::RB_RED) ||
+                                     (x->right != NULL && x->right->color() == ft::RB_RED)))
+        return -1;
+    const int left = checked_black_height(x->left);
+    const int right = checked_black_height(x->right);
+    if (left < 0 || left != right)
+        return -1;
+    return left + (x->color() == ft::RB_BLACK);
+}
+
+template <class Tree>
+static bool is_valid_range(const Tree &tree, int first, int last)
+{
+    if (tree.size() != static_cast<size_t>(last - first))
+        return false;
+    int expected = first;
+    for (typename Tree::const_iterator it = tree.begin(); it != tree.end(); ++it)
+        if (*it != expected++)
+            return false;
+    if (tree.empty())
+        return true;
+    const ft::rb_node_base *root = tree.begin().base();
+    while (!ft::rb_node_base::is_header(root->parent()))
+        root = root->parent();
+    return root->color() == ft::RB_BLACK && checked_black_height(root) > 0;
+}
+
+TEST(rb_tree, split_and_join)
+{
+    for (int n = 0; n < 40; ++n)
+        for (int k = -1; k <= n + 1; ++k)
+        {
+            ft::rb_tree<int> tree;
+            ft::rb_tree<int> upper;
+            for (int i = 0; i < n; ++i)
+                tree.insert_unique((i * 7919) % n);
+            upper.insert_unique(-100);
+
+            tree.split(k, upper);
+            bool ok = is_valid_range(tree, 0, std::max(0, std::min(k, n)));
+            ok = ok && is_valid_range(upper, std::max(0, std::min(k, n)), n);
+
+            tree.join(upper);
+            ok = ok && upper.empty() && is_valid_range(tree, 0, n);
+
+            tree.insert_unique(n);
+            tree.remove(0);
+            ok = ok && is_valid_range(tree, 1, n + 1);
+
+            ASSERT(ok)
+        }
+}
+
+TEST(rb_tree, split_and_join_reuse_nodes)
+{
+    counted_tree tree;
+    for (int i = 0; i < 5000; ++i)
+        tree.insert((i * 7919) % 5000);
+
+    const int *node = &*tree.find(4000);
+    counted_tree upper;
+    tree.split(2500, upper);
+
+    ASSERT(tree.size() == 2500 && upper.size() == 2500 && &*upper.find(4000) == node)
+    ASSERT(counts_are_consistent(tree) && counts_are_consistent(upper))
+    ASSERT(is_valid_range(upper, 2500, 5000))
+
+    // Uneven heights on both sides, then ranges that overlap, then
+    // separate pools.
+    counted_tree small(std::less<int>(), tree.get_allocator());
+    small.insert(5000);
+    upper.join(small);
+    tree.join(upper);
+
+    ASSERT(is_valid_range(tree, 0, 5001) && counts_are_consistent(tree) && &*tree.find(4000) == node)
+
+    counted_tree low(std::less<int>(), tree.get_allocator());
+    for (int i = 0; i < 3; ++i)
+        low.insert(i * 2);
+    tree.split(2, upper);
+    upper.join(low);
+
+    ASSERT(upper.size() == 5002 && counts_are_consistent(upper) && upper.count(2) == 2 && low.empty())
+
+    counted_tree separate;
+    separate.insert(6000);
+    upper.join(separate);
+
+    ASSERT(upper.size() == 5003 && counts_are_consistent(upper) && separate.empty())
+}
+
+TEST(rb_tree, join_unique_overlapping)
+{
+    counted_tree tree;
+    counted_tree right(std::less<int>(), tree.get_allocator());
+    for (int i = 0; i < 100; ++i)
+        tree.insert_unique(i * 2);
+    for (int i = 50; i < 150; ++i)
+        right.insert_unique(i * 2 + (i % 2));
+
+    // Even keys below 200 are already present and stay in right.
+    tree.join_unique(right);
+
+    ASSERT(tree.size() == 175 && right.size() == 25)
+    ASSERT(tree.count(196) == 1 && tree.count(199) == 1 && right.count(196) == 1)
+    ASSERT(counts_are_consistent(tree) && counts_are_consistent(right))
+
+    counted_tree separate;
+    separate.insert_unique(0);
+    separate.insert_unique(1000);
+    tree.join_unique(separate);
+
+    ASSERT(tree.size() == 176 && tree.count(0) == 1 && tree.count(1000) == 1)
+    ASSERT(separate.size() == 1 && counts_are_consistent(tree))
+
+    counted_tree upper(std::less<int>(), tree.get_allocator());
+    upper.insert_unique(2000);
+    tree.join_unique(upper);
+
+    ASSERT(tree.size() == 177 && upper.empty() && counts_are_consistent(tree))
+}
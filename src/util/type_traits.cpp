@@ -0,0 +1,38 @@
+#include "test_container.hpp"
+#include "util/type_traits.hpp"
+#include <string>
+
+struct trivial_point
+{
+    int x;
+    int y;
+};
+
+struct opt_in_handle
+{
+    int fd;
+
+    opt_in_handle() : fd(-1) {}
+
+    opt_in_handle(const opt_in_handle &other) : fd(other.fd) {}
+};
+
+namespace ft
+{
+    template <>
+    struct is_trivially_copyable<opt_in_handle> : public true_type { };
+}
+
+TEST(type_traits, is_trivially_copyable)
+{
+    ASSERT(ft::is_trivially_copyable<int>::value)
+    ASSERT(ft::is_trivially_copyable<const double>::value)
+    ASSERT(ft::is_trivially_copyable<char *>::value)
+    ASSERT(ft::is_trivially_copyable<trivial_point>::value)
+    ASSERT(!ft::is_trivially_copyable<std::string>::value)
+}
+
+TEST(type_traits, is_trivially_copyable_opt_in)
+{
+    ASSERT(ft::is_trivially_copyable<opt_in_handle>::value)
+}